@@ -46,6 +46,60 @@
 #define ENTITY_INDEX(node) (node).common.base.index
 /*@Non-separable : END*/
 
+/* Sweep backward analyses in the reverse postorder of the reverse CFG
+   in the round robin solver too. Off by default so that the iteration
+   counts match the reference dumps. */
+#ifndef REVERSE_CFG_ROUND_ROBIN
+#define REVERSE_CFG_ROUND_ROBIN 0
+#endif
+
+/* Solve separable gen-kill analyses one tile of entities at a time (see
+   perform_tiled_pfbvdfa) when the words of their dfvalues at all basic
+   blocks take more than GDFA_TILE_BYTES, which should be the size of
+   the L2 cache of the host. GDFA_THREADS greater than one spreads the
+   tiles over that many POSIX threads, tiling by the number of threads
+   alone if GDFA_TILE_BYTES is 0, and then needs -pthread when cc1 is
+   linked (see check-tiling in Test/Makefile). Both are off by default
+   so that the visit counts match the reference dumps. */
+#ifndef GDFA_TILE_BYTES
+#define GDFA_TILE_BYTES 0
+#endif
+
+#ifndef GDFA_THREADS
+#define GDFA_THREADS 1
+#endif
+
+#if GDFA_THREADS > 1
+#include <pthread.h>
+#endif
+
+/* Check the entity indices of the preserved dfi of basic blocks of
+   every analysis against IN and OUT (see verify_dfi_entity_index). Off
+   by default since it builds both indices of every analysis (see
+   check-entity-index in Test/Makefile). */
+#ifndef CHECK_GDFA_ENTITY_INDEX
+#define CHECK_GDFA_ENTITY_INDEX 0
+#endif
+
+/* Solve non-separable analyses one independent group of entities at a
+   time (see solve_entity_components). Off by default so that the
+   detailed dumps of analyses with more than one word of entities match
+   the reference dumps. -fgdfa-partition and -fno-gdfa-partition
+   override it (see override_dfa_spec). */
+#ifndef PARTITION_GDFA_ENTITIES
+#define PARTITION_GDFA_ENTITIES 0
+#endif
+
+/* Keep the values of the statements of non-separable analyses only at
+   the boundaries of their basic blocks, and replay the statements of a
+   basic block when their values are read (see struct stmt_replay), for
+   the analyses whose statements have at most two constant entities in
+   GEN and in KILL. Off by default; -fgdfa-stmt-dfi-at-boundaries and
+   its -fno- form override it (see override_dfa_spec). */
+#ifndef STMT_DFI_AT_BOUNDARIES
+#define STMT_DFI_AT_BOUNDARIES 0
+#endif
+
 /***    Generic Bit Vector Data Flow Analyzer for Gimple IR with 
         example instantiations for several bit vector frameworks 
 
@@ -94,7 +148,10 @@
           ("identity", "gen_kill", and "stop_flow") have been also defined. 
           Thus the user has to provide only the non-default flow functions. An
           example of "stop_flow" is the backward node and edge flow functions 
-          in available expressions analysis.
+          in available expressions analysis. The default flow functions
+          return dfvalues owned by the driver, whereas a user defined flow
+          function must return a newly allocated dfvalue which the driver
+          frees after using it.
 
         - Specify the semantics of local properties GEN and KILL.
           (Details are given below.)
@@ -190,6 +247,32 @@
           of building GCC.
            
      
+        The fixed point can be computed by six solvers, selected by the
+        "solver" field of the specification. ROUND_ROBIN sweeps over all
+        basic blocks in the traversal order until no value changes.
+        WORKLIST seeds a work list with the basic blocks in the same
+        order and revisits a basic block only when a value it depends on
+        has changed. PRIORITY_WORKLIST always visits the queued basic
+        block that comes next in the reverse postorder of the CFG (of
+        the reverse CFG for backward analyses), so that the visits to a
+        basic block are bounded by the loop connectedness of the CFG
+        rather than by the number of sweeps. In both work list solvers a
+        change in OUT(bb) is propagated to the successors unless
+        forward_edge_flow is stop_flow_along_edge, a change in IN(bb) is
+        propagated to the predecessors unless backward_edge_flow is
+        stop_flow_along_edge, and bb itself is revisited when the value
+        computed later in the visit feeds the value computed earlier
+        through a node flow. WEAK_TOPOLOGICAL_ORDER solves the basic
+        blocks in a weak topological order, iterating each loop
+        component to a fixed point before moving outwards and passing
+        over components that have stabilised. HIERARCHICAL uses the
+        same order as a loop tree and, for separable specs with the
+        default gen-kill flows, summarises each loop in closed form so
+        that every basic block is solved once. ELIMINATION solves the
+        same specs without iterating, by Gaussian elimination over the
+        equations of all basic blocks, for reducible and irreducible
+        CFGs alike.
+
         Compile time option "-fdump-tree-all" creates the dump files.
         Initial and final values are printed by the option
         "-fgdfa". Values in each iteration are printed by the option
@@ -204,8 +287,6 @@
 
           - Consider scalar formal parameters for analysis.
 
-          - Support a work list based driver.
-
           - Extend gdfa to support definitions as entities and specify
             reaching definitions analysis.
 
@@ -267,14 +348,170 @@
 /************ Generic bit vector data flow analysis driver **************/
 
 
+/* Storage of a dfi set. Instead of allocating every pfbv_dfi and each
+   of its dfvalues separately, the pfbv_dfi of all the nodes are allocated
+   together and their GEN, KILL, IN and OUT are rows of one slab of
+   dfvalues per property. For basic blocks the rows follow the order in
+   which the analysis visits them (see row_order_of_bbs) so that a sweep
+   streams through each slab. In small universes the four dfvalues of a
+   node are small, and are kept side by side in a single slab of rows
+   instead, so a node is read from one place. Hence the dfvalues of a
+   dfi set are never freed or replaced individually; preserve_dfi
+   releases whole slabs.
+
+   None of this is garbage collected. What preserve_dfi keeps is chained
+   on preserved_dfi_storage and released by release_preserved_dfi when
+   the next function is initialised, since by then the clients compute
+   their data flow information afresh.
+*/
+
+typedef struct dfi_storage
+{
+        pfbv_dfi ** dfi;
+        pfbv_dfi * nodes;
+        dfvalue_slab gen;
+        dfvalue_slab kill;
+        dfvalue_slab in;
+        dfvalue_slab out;
+        dfvalue_slab rows;                /* of small universes */
+        struct pfbv_dfi_delta * deltas;
+        struct stmt_replay * replay;
+        int count;
+        bool of_bbs;
+        struct dfi_storage * next;
+} dfi_storage;
+
+/* Compact preserved dfi sets. Once a dfi set is preserved, the value
+   on the exit side of a node (OUT in a forward analysis, IN in a
+   backward one) may be kept as a delta against the value on its entry
+   side, and the value on the entry side as a delta against the exit
+   side of the neighbour it differs least from: a predecessor of a basic
+   block in a forward analysis, a successor in a backward one, and the
+   adjacent statement for statements. A value is kept whole when its
+   delta would not be smaller than its dense words, or when the chain
+   of deltas leading to it from a whole value would exceed
+   DFI_DELTA_MAX_CHAIN, so that decoding a value applies a bounded
+   number of deltas. The base of a delta is always the value on the
+   other side of in_base or out_base. The statements whose values are
+   kept at the boundaries of basic blocks share one delta, which names
+   the replay state instead.
+
+   A value kept as a delta is decoded, when it is read, into one of
+   DECODED_DFVALUE_CACHE_SIZE values, the least recently used of which
+   is reused (see decoded_dfvalue), so the nodes never hold decoded
+   values.
+*/
+
+#define DFI_DELTA_MAX_CHAIN 8
+#define DECODED_DFVALUE_CACHE_SIZE 8
+
+struct pfbv_dfi_delta
+{
+        dfvalue_delta in;
+        dfvalue_delta out;
+        pfbv_dfi * in_base;
+        pfbv_dfi * out_base;
+        struct stmt_replay * replay;
+};
+
+struct decoded_dfvalue_entry
+{
+        pfbv_dfi * node;        /* NULL if unused */
+        bool out;
+        int last_use;
+        dfvalue value;
+};
+
+static struct decoded_dfvalue_entry decoded_dfvalues[DECODED_DFVALUE_CACHE_SIZE];
+static int decoded_dfvalue_uses = 0;
+
+static dfi_storage * bb_dfi_storage = NULL;
+static dfi_storage * stmt_dfi_storage = NULL;
+static dfi_storage * preserved_dfi_storage = NULL;
+
+/* Compaction of the universe of an analysis. In a separable analysis
+   with the default gen-kill flows each entity is solved on its own, and
+   an entity that is in no GEN has the same solution as one that is in
+   no GEN and no KILL only if it is empty at every basic block whatever
+   kills it. That needs ZEROS at the boundaries and a UNION confluence
+   with ZEROS as top: under INTERSECTION a basic block that does not
+   reach the boundary, such as one in an infinite loop, starts at ONES,
+   and a KILL there lowers the entity. Otherwise the entity must be in
+   no KILL either. compact_entity_universe solves such analyses
+   over the other entities only, followed by one position which stands
+   for all the entities left out. The GEN and KILL built over the
+   original universe are kept in full_bb_dfi_storage, whose IN and OUT
+   are filled in from the compacted solution for the dumps and when the
+   analysis ends; the clients see the original bit positions only.
+   compacted_entities gives the original entity at each compacted
+   position but the last, and is NULL when the universe is not
+   compacted.
+*/
+
+static int * compacted_entities = NULL;
+static int full_entity_count = 0;
+static dfi_storage * full_bb_dfi_storage = NULL;
+
+/*@Non-separable : START*/
+/* Partition of the universe of a non-separable analysis. The compiled
+   transfers of a statement couple the entities they test with those
+   they generate or kill, and entities that are not coupled, directly
+   or through others, never affect the values of each other.
+   solve_entity_components finds the connected components of the
+   coupling with a union-find over the entities, packs them into
+   subproblems of about a word of entities, and solves each subproblem
+   over a universe of its own entities, scattering its solution into
+   the storages of the full universe, which full_bb_dfi_storage and the
+   statement storage keep meanwhile. The round robin solver needs as
+   many iterations for the whole problem as for its slowest subproblem,
+   and that is what is reported; the values after each iteration are
+   not dumped.
+*/
+
+static bool partition_entities = PARTITION_GDFA_ENTITIES;
+static bool stmt_dfi_at_boundaries = STMT_DFI_AT_BOUNDARIES;
+static bool solving_components = false;
+static const char * component_count_name = NULL;
+static int component_count = 0;
+/*@Non-separable : END*/
+
 pfbv_dfi ** gdfa_driver(struct gimple_pfbv_dfa_spec dfa_spec);
 static void perform_pfbvdfa(void);
+static void perform_round_robin_pfbvdfa(void);
+static void perform_worklist_pfbvdfa(void);
+static void perform_wto_pfbvdfa(void);
+static void perform_hierarchical_pfbvdfa(void);
+static void perform_elimination_pfbvdfa(void);
+static void perform_tiled_pfbvdfa(void);
+static void visit_bb_in_traversal_order(basic_block bb, bool *change_at_in, bool *change_at_out);
+static void add_dependent_bbs_to_worklist(basic_block bb, bool change_at_in, bool change_at_out);
 static bool compute_in_info(basic_block bb);
 static bool compute_out_info(basic_block bb);
 static dfvalue combined_forward_edge_flow(basic_block bb);
 static dfvalue combined_backward_edge_flow(basic_block bb);
+static dfvalue node_flow_of_bb(dfvalue (*node_flow)(basic_block), basic_block bb);
+static void create_scratch_dfvalues(void);
+static void free_scratch_dfvalues(void);
+static bool use_tiles(void);
 static void preserve_dfi(dfi_to_be_preserved preserve);
-static void create_dfi_space(int);
+#if CHECK_GDFA_ENTITY_INDEX
+static void verify_dfi_entity_index(pfbv_dfi ** dfi);
+#endif
+static dfi_storage * create_dfi_space(int count, const int * row_of_node);
+static int * row_order_of_bbs(traversal_direction direction);
+static void release_dfi_storage(dfi_storage * storage, int count, dfi_to_be_preserved preserve);
+static void intern_dfi_storage(dfi_storage * storage);
+static bool is_closed_form_solution_possible(void);
+static bool compact_entity_universe(struct gimple_pfbv_dfa_spec dfa_spec);
+static void expand_compacted_dfvalue(dfvalue full, dfvalue value);
+static void expand_compacted_dfi(void);
+static void end_entity_compaction(void);
+/*@Non-separable : START*/
+static bool solve_entity_components(struct gimple_pfbv_dfa_spec dfa_spec);
+/*@Non-separable : END*/
+static void encode_dfi_storage(dfi_storage * storage, bool of_bbs);
+static void encode_dfi_value(dfi_storage * storage, int * depth, pfbv_dfi * node, 
+                             bool out, pfbv_dfi * base);
 static void initialise_special_values(struct gimple_pfbv_dfa_spec dfa_spec);
 static int find_entity_size(struct gimple_pfbv_dfa_spec dfa_spec);
 
@@ -294,11 +531,15 @@ dfvalue stop_flow_along_node(basic_block bb);
 dfvalue stop_flow_along_edge(basic_block src, basic_block dest);
 dfvalue forward_gen_kill_node_flow(basic_block bb);
 dfvalue backward_gen_kill_node_flow(basic_block bb);
+static void forward_gen_kill_node_flow_into(dfvalue result, basic_block bb);
+static void backward_gen_kill_node_flow_into(dfvalue result, basic_block bb);
+static bool is_borrowed_edge_flow(dfvalue (*edge_flow)(basic_block, basic_block));
+static bool is_borrowed_node_flow(dfvalue (*node_flow)(basic_block));
 
 /********* dfvalue support functions for flow functions ********/
 
 static dfvalue combine (dfvalue value1, dfvalue value2);
-static bool is_new_info(dfvalue prev_info,dfvalue new_info);
+static void combine_into (dfvalue dest, dfvalue value1, dfvalue value2);
 
 /***************  Specification Driven Local Property Computation ***************/
 
@@ -311,9 +552,22 @@ static dfvalue defn_in_statement(tree stmt, lp_specs lps);
 /*@Non-separable : START*/
 static void    local_dfa_nonseparable(struct gimple_pfbv_dfa_spec dfa_spec);
 static dfvalue local_dfa_of_stmt(lp_specs_nonseparable lps_given, tree bb);
-static dfvalue var_in_statement_nonseparable(tree stmt, lp_specs_nonseparable lps, dfvalue globaldf);
-static dfvalue update_gen_of_stmt(tree, lp_specs_nonseparable, dfvalue);
-static dfvalue update_kill_of_stmt(tree, lp_specs_nonseparable, dfvalue);
+static void    operands_of_stmt_nonseparable(tree stmt, int * lval_index, int * left_opd_index,
+                                             int * right_opd_index, bool * operand_is_constant);
+static dfvalue var_in_statement_nonseparable(tree stmt, lp_specs_nonseparable lps);
+static void    compile_stmt_transfers(void);
+static bool    compile_const_stmt_transfers(void);
+static void    apply_stmt_transfers(dfvalue result, int stmt_index);
+static void    replay_stmts_of_bb(dfvalue result, dfvalue entry, int nid, bool forward);
+static void    free_stmt_transfers(void);
+static dfi_storage * create_replayed_dfi_space(int count);
+static void    connect_stmt_replay(void);
+static void    evaluate_stmts_at_boundaries(dfvalue result, dfvalue entry, int nid, bool forward);
+static void    forget_replayed_blocks(struct stmt_replay * replay, int nid);
+static void    preserve_replayed_dfi(dfi_to_be_preserved preserve);
+static void    free_stmt_replay(struct stmt_replay * replay);
+static struct replayed_block * replayed_block_of(struct stmt_replay * replay, int nid);
+static dfvalue read_replayed_dfvalue(struct stmt_replay * replay, pfbv_dfi * node, int side);
 /*@Non-separable : END*/
         
 /************ End of specification driven local property computation ***********/
@@ -322,7 +576,7 @@ static dfvalue update_kill_of_stmt(tree, lp_specs_nonseparable, dfvalue);
 
 static void print_entity_info(void);
 static void print_initial_dfi(void);
-static void print_final_dfi(int count);
+static void print_final_dfi(const char *count_name, int count);
 static void print_per_iteration_dfi(int iteration);
 
 /************ Lower level functions to print the result of data flow analysis   ***********/
@@ -349,6 +603,7 @@ extern int local_var_count;
 extern int local_defn_count;
 extern int number_of_nodes;
 extern varray_type dfs_ordered_basic_blocks; 
+extern varray_type reverse_dfs_ordered_basic_blocks; 
 /*@Non-separable : START*/
 extern tree * local_stmt_list;
 extern int local_stmt_count;
@@ -358,6 +613,7 @@ extern void assign_indices_to_stmt(void);
 
 static traversal_direction traversal_order;
 static meet_operation confluence;
+static solver_strategy solver;
 
 static initial_value top_value_spec;
 static dfvalue value_top = NULL;
@@ -373,6 +629,108 @@ pfbv_dfi ** current_pfbv_dfi_of_stmt = NULL;
 static bool is_nonseparable = false; 
 static lp_specs_nonseparable gen_lps, kill_lps;
 static change_at_in_out_of_stmt; 
+
+/* Compiled statement transfers. The part of GEN or KILL of a statement
+   which depends on the value flowing into it tests at most two entities
+   against that value and, if the test succeeds, generates or kills at
+   most two entities: the lvalue for entity_mod and the operands for
+   entity_use. The test is on the lvalue for the X_ dependences and on
+   the operands for the OPER_ ones, and needs some tested entity in the
+   value for the _IN_ dependences and none for the _NOT_IN_ ones. Every
+   dependence of entity_mod, and those on the lvalue of entity_use,
+   apply only to statements with a local lvalue.
+
+   local_dfa_nonseparable compiles the transfers of every statement once,
+   together with the statements of each basic block in stmts_of_bbs,
+   those of basic block nid starting at first_stmt_of_bb[nid]. The node
+   flows then only test and set bits of the value flowing through the
+   basic block, instead of walking the trees of every statement and
+   allocating dfvalues for it in every iteration.
+*/
+
+typedef struct stmt_transfer
+{
+        int test[2];            /* entities tested, -1 if none */
+        int effect[2];          /* entities generated or killed, -1 if none */
+        bool when_in;
+} stmt_transfer;
+
+static stmt_transfer * gen_transfer_of_stmt = NULL;
+static stmt_transfer * kill_transfer_of_stmt = NULL;
+static int * first_stmt_of_bb = NULL;
+static int * stmts_of_bbs = NULL;
+
+/* Statement level replay (see replay_stmts_of_bb). replayed_bbs holds
+   the basic blocks whose statements have been evaluated in full once.
+   The entities that have changed in the value flowing into the current
+   statement are in changed_entities, those that have changed in the
+   value flowing out of it are gathered in next_changed_entities, and
+   entity_stamp[e] is replay_stamp while e is among the former.
+*/
+
+static sbitmap replayed_bbs = NULL;
+static unsigned int * changed_entities = NULL;
+static unsigned int * next_changed_entities = NULL;
+static int * entity_stamp = NULL;
+static int replay_stamp = 0;
+
+/* Statement values kept at the boundaries of basic blocks (see
+   STMT_DFI_AT_BOUNDARIES). The statement storage then has nodes but no
+   slabs, and the delta of every node names the replay state. The node
+   flows keep the value flowing into each basic block when they last
+   evaluated it in entry_of_bb, NULL if they never have, and the value
+   flowing out of it in the exit slab, and evaluate the statements of
+   a basic block only when its entry has changed. When the values of a
+   statement are read, those of all the statements of its basic block
+   are replayed from the entry (see replayed_block_of) into one of
+   STMT_REPLAY_CACHE_BLOCKS blocks of values, the least recently used
+   of which is reused. The nodes of the statements of a cached basic
+   block point at its values and the others at none. GEN and KILL of a
+   statement are then what its constant transfers, which test nothing,
+   generate and kill. The clients read the values in the blocks
+   themselves (see read_replayed_dfvalue).
+
+   A preserved statement storage keeps the entries, interned, together
+   with the transfers and the statements of the basic blocks, so that
+   the clients read the values of the statements as they were solved.
+*/
+
+#define STMT_REPLAY_CACHE_BLOCKS 4
+
+struct replayed_block
+{
+        int nid;                /* -1 if unused */
+        int last_use;
+        dfvalue * values;       /* GEN, KILL, IN and OUT of each statement */
+};
+
+struct stmt_replay
+{
+        pfbv_dfi * nodes;
+        stmt_transfer * gen;
+        stmt_transfer * kill;
+        stmt_transfer * const_gen;
+        stmt_transfer * const_kill;
+        int * first_stmt_of_bb;
+        int * stmts_of_bbs;
+        int * bb_of_stmt;
+        dfvalue * entry_of_bb;
+        dfvalue_slab entry;
+        dfvalue_slab exit;
+        dfvalue top;
+        unsigned int n_bits;
+        int bb_count;
+        int stmt_count;
+        bool forward;
+        bool keeps_local;
+        int uses;
+        struct pfbv_dfi_delta delta;
+        struct replayed_block cache[STMT_REPLAY_CACHE_BLOCKS];
+};
+
+static stmt_transfer * const_gen_transfer_of_stmt = NULL;
+static stmt_transfer * const_kill_transfer_of_stmt = NULL;
+static struct stmt_replay * stmt_replay = NULL;
 /*@Non-separable : END*/
 
 
@@ -381,12 +739,67 @@ extern FILE * dump_file;
 
 static void debug_statement_expr(void);
 static void print_dfi(FILE*);
+
+/* The solver and the representation of a specification change how its
+   analysis is solved but not the result, so the tests run every
+   specification under each of them against the same reference dumps
+   (see check-solvers and check-representations in Test/Makefile). The
+   options -fgdfa-solver= and -fgdfa-representation=, if given, name the
+   solver and the representation used for every specification instead
+   of its own. The run form is not a representation. The partitioning of
+   the entities of non-separable analyses and the replay of their
+   statements are checked the same way, through -fgdfa-partition and
+   -fgdfa-stmt-dfi-at-boundaries. */
+
+static void
+override_dfa_spec(struct gimple_pfbv_dfa_spec * dfa_spec)
+{
+        static const char * const solver_names[] = 
+                { NULL, "round_robin", "worklist", "priority_worklist",
+                  "weak_topological_order", "hierarchical", "elimination" };
+        static const char * const representation_names[] = 
+                { NULL, "dense", "sparse", NULL, "adaptive" };
+        int i;
+
+        if (flag_gdfa_solver)
+        {
+                for (i = ROUND_ROBIN; i <= ELIMINATION && strcmp(flag_gdfa_solver, solver_names[i]) != 0; i++)
+                        ;
+                if (i > ELIMINATION)
+                        report_dfa_spec_error("Unknown solver in -fgdfa-solver= (Function override_dfa_spec)");
+                dfa_spec->solver = (solver_strategy) i;
+        }
+
+        if (flag_gdfa_representation)
+        {
+                for (i = DENSE_DFVALUE; i <= ADAPTIVE_DFVALUE; i++)
+                        if (representation_names[i] && strcmp(flag_gdfa_representation, representation_names[i]) == 0)
+                                break;
+                if (i > ADAPTIVE_DFVALUE)
+                        report_dfa_spec_error("Unknown representation in -fgdfa-representation= (Function override_dfa_spec)");
+                dfa_spec->representation = (dfvalue_form) i;
+        }
+
+        /* -1 when neither the option nor its -fno- form is given. */
+        if (flag_gdfa_partition >= 0)
+                partition_entities = (flag_gdfa_partition != 0);
+        if (flag_gdfa_stmt_dfi_at_boundaries >= 0)
+                stmt_dfi_at_boundaries = (flag_gdfa_stmt_dfi_at_boundaries != 0);
+}
+
 pfbv_dfi ** 
 gdfa_driver(struct gimple_pfbv_dfa_spec dfa_spec)
 {
+        int * row_of_bb;
+
+        override_dfa_spec(&dfa_spec);
         if (find_entity_size(dfa_spec) == 0)
                 return NULL;
 
+        ensure_cfg_orders();
+        clear_dfvalue_statistics();
+        create_dfvalue_pool(dfa_spec.representation);
+
 	initialise_special_values(dfa_spec);
 
         if(IS_NONSEPARABLE(dfa_spec))
@@ -406,34 +819,66 @@ gdfa_driver(struct gimple_pfbv_dfa_spec dfa_spec)
                 kill_lps.dependence          = dfa_spec.dependent_kill;
 
 
-                create_dfi_space(local_stmt_count);
-                current_pfbv_dfi_of_stmt = current_pfbv_dfi;
+                /* The statements are replayed only if the constant parts
+                   of their GEN and KILL can be compiled */
+                if (stmt_dfi_at_boundaries && compile_const_stmt_transfers())
+                        stmt_dfi_storage = create_replayed_dfi_space(local_stmt_count);
+                else
+                        stmt_dfi_storage = create_dfi_space(local_stmt_count, NULL);
+                current_pfbv_dfi_of_stmt = stmt_dfi_storage->dfi;
+                stmt_replay = stmt_dfi_storage->replay;
 
-                create_dfi_space(number_of_nodes);
+                row_of_bb = row_order_of_bbs(dfa_spec.traversal_order);
+                bb_dfi_storage = create_dfi_space(number_of_nodes, row_of_bb);
+                current_pfbv_dfi = bb_dfi_storage->dfi;
+                XDELETEVEC(row_of_bb);
 
                 local_dfa_nonseparable(dfa_spec);
 		/*debug_statement_expr();*/
         } else {
-                create_dfi_space(number_of_nodes); 
+                row_of_bb = row_order_of_bbs(dfa_spec.traversal_order);
+                bb_dfi_storage = create_dfi_space(number_of_nodes, row_of_bb); 
+                current_pfbv_dfi = bb_dfi_storage->dfi;
+                XDELETEVEC(row_of_bb);
                 local_dfa(dfa_spec); 
         }
 
         traversal_order = dfa_spec.traversal_order; 
         confluence = dfa_spec.confluence;
+        solver = dfa_spec.solver;
 
         forward_edge_flow = dfa_spec.forward_edge_flow;
         backward_edge_flow = dfa_spec.backward_edge_flow;
         forward_node_flow = dfa_spec.forward_node_flow;
         backward_node_flow = dfa_spec.backward_node_flow;
 
-        perform_pfbvdfa();
+        compact_entity_universe(dfa_spec);
+        if (!solve_entity_components(dfa_spec))
+                perform_pfbvdfa();
+        if (compacted_entities)
+                end_entity_compaction();
+
+        if (dump_file && (dump_flags & TDF_STATS))
+                dump_dfvalue_statistics(dump_file);
 
+        /* The statements replayed from the boundaries of basic blocks
+           keep the transfers */
         preserve_dfi(dfa_spec.preserved_dfi); 
+        free_stmt_transfers();
+#if CHECK_GDFA_ENTITY_INDEX
+        if (current_pfbv_dfi)
+                verify_dfi_entity_index(current_pfbv_dfi);
+#endif
+
+        /* value_top, entry_info and exit_info go with the pool */
+        free_dfvalue_pool();
+        value_top = entry_info = exit_info = NULL;
 
+        /* The next analysis may be separable */
         if(is_nonseparable) 
         {
-                return current_pfbv_dfi_of_stmt;
                 is_nonseparable = false;
+                return current_pfbv_dfi_of_stmt;
         } else {
                 return current_pfbv_dfi; 
         }
@@ -478,801 +923,4200 @@ find_entity_size(struct gimple_pfbv_dfa_spec dfa_spec)
 }
 
 
-static void 
-perform_pfbvdfa(void)
-{
-        int visit_bb=0, iteration_number=0;
-        basic_block bb;
-        bool change, change_at_in, change_at_out;
- 
-	print_initial_dfi(); 
-
-        do{        
-                iteration_number++;
-                change = false;
-                FOR_EACH_BB_IN_SPECIFIED_TRAVERSAL_ORDER  
-                {         
-                        bb = VARRAY_BB(dfs_ordered_basic_blocks,visit_bb);
-                        if(bb)
-                        {        
-                                if (traversal_order == FORWARD)
-                                {
-                                        change_at_in = compute_in_info(bb);
-                                        change_at_out = compute_out_info(bb);
-                                        change = change || change_at_out || change_at_in;
-                                }
-                                else if ((traversal_order == BACKWARD) || (traversal_order == BIDIRECTIONAL))
-                                {
-                                        change_at_out = compute_out_info(bb);
-                                        change_at_in = compute_in_info(bb);
-                                        change = change || change_at_in || change_at_out;
-                                }
-                                else 
-                                         report_dfa_spec_error ("Direction can only be FORWARD, BACKWARD, or BIDIRECTIONAL (Function perform_pfbvdfa)");
-                        }
-                }
-		print_per_iteration_dfi(iteration_number); 
-        } while(change);
+/* Moves a separable analysis with the default flows to a compacted
+   universe (see compacted_entities) once its local properties have
+   been computed, if that saves words in its dfvalues. The pool and the
+   special values are made afresh for the compacted universe. Returns
+   true if the universe has been compacted.
+*/
 
-	print_final_dfi(iteration_number);
+static bool
+compact_entity_universe(struct gimple_pfbv_dfa_spec dfa_spec)
+{
+        bool kill_matters = (dfa_spec.entry_info != ZEROS || dfa_spec.exit_info != ZEROS
+                             || dfa_spec.confluence == INTERSECTION
+                             || dfa_spec.top_value_spec != ZEROS);
+        dfvalue participants;
+        int * row_of_bb;
+        int nid, entity, count = 0;
+
+        if (!is_closed_form_solution_possible())
+                return false;
+
+        participants = make_initialised_dfvalue(ZEROS);
+        for (nid=0; nid < number_of_nodes; nid++)
+        {
+                union_dfvalues_into(participants, participants, GEN_nid(current_pfbv_dfi,nid));
+                if (kill_matters)
+                        union_dfvalues_into(participants, participants, KILL_nid(current_pfbv_dfi,nid));
+        }
+        compacted_entities = XNEWVEC(int, relevant_pfbv_entity_count);
+        for (entity=0; entity < relevant_pfbv_entity_count; entity++)
+                if (dfvalue_bit_p(participants, entity))
+                        compacted_entities[count++] = entity;
+        free_dfvalue_space(participants);
 
-}
+        if (SBITMAP_SET_SIZE(count + 1) >= SBITMAP_SET_SIZE(relevant_pfbv_entity_count))
+        {
+                XDELETEVEC(compacted_entities);
+                compacted_entities = NULL;
+                return false;
+        }
 
-static bool 
-compute_in_info(basic_block bb)
-{        
-        bool change;
-        dfvalue temp, old;
+        full_entity_count = relevant_pfbv_entity_count;
+        full_bb_dfi_storage = bb_dfi_storage;
 
-        temp = make_uninitialised_dfvalue();
-        change_at_in_out_of_stmt = false;
+        free_dfvalue_pool();
+        relevant_pfbv_entity_count = count + 1;
+        create_dfvalue_pool(dfa_spec.representation);
+        initialise_special_values(dfa_spec);
 
-        if (!bb->preds) 
-                temp = combine(entry_info, backward_node_flow(bb));
-        else 
-                temp = combine(combined_forward_edge_flow(bb),
-                                     backward_node_flow(bb));
+        row_of_bb = row_order_of_bbs(traversal_order);
+        bb_dfi_storage = create_dfi_space(number_of_nodes, row_of_bb);
+        current_pfbv_dfi = bb_dfi_storage->dfi;
+        XDELETEVEC(row_of_bb);
 
-        /*DEBUG*/
-        //if(is_nonseparable ) { 
-        //    fprintf(stdout, "in compute_in_info");  
-        //    dump_dfvalue(stdout, temp);
-        //}
-                            
-        old = CURRENT_IN(bb);
-        change = is_new_info(temp,old);
-        if (change)
+        for (nid=0; nid < number_of_nodes; nid++)
         {
-                CURRENT_IN(bb) = temp;
-                if (old)
-                        free_dfvalue_space(old);
+                for (entity=0; entity < count; entity++)
+                {
+                        if (dfvalue_bit_p(GEN_nid(full_bb_dfi_storage->dfi,nid), compacted_entities[entity]))
+                                set_dfvalue_bit(GEN_nid(current_pfbv_dfi,nid), entity);
+                        if (dfvalue_bit_p(KILL_nid(full_bb_dfi_storage->dfi,nid), compacted_entities[entity]))
+                                set_dfvalue_bit(KILL_nid(current_pfbv_dfi,nid), entity);
+                }
+                compute_dfvalue_span(GEN_nid(current_pfbv_dfi,nid));
+                compute_dfvalue_span(KILL_nid(current_pfbv_dfi,nid));
         }
-        return change || change_at_in_out_of_stmt ;
+        return true;
 }
 
-static bool 
-compute_out_info(basic_block bb)
-{        
-        bool change;
-        dfvalue temp, old;
-
-        temp = make_uninitialised_dfvalue();
-        change_at_in_out_of_stmt = false;
+/* Writes value, over the compacted universe, into full, over the
+   original one. The entities left out take the value of the last
+   position.
+*/
 
-        if (!bb->succs)
-                temp = combine(exit_info, forward_node_flow(bb));
-        else
-                temp = combine(combined_backward_edge_flow(bb),
-                                     forward_node_flow(bb));
-                       
-        /*DEBUG*/
-        //if(is_nonseparable ) { 
-        //    fprintf(stdout, "in compute_out_info");  
-        //    dump_dfvalue(stdout, temp);
-        //}
+static void
+expand_compacted_dfvalue(dfvalue full, dfvalue value)
+{
+        int count = value->n_bits - 1;
+        bool left_out = dfvalue_bit_p(value, count);
+        int entity;
 
-        old = CURRENT_OUT(bb);
-        change = is_new_info(temp,old);
-        if (change)
+        initialise_dfvalue(full, left_out ? ONES : ZEROS);
+        for (entity=0; entity < count; entity++)
         {
-                CURRENT_OUT(bb) = temp;
-                if (old)
-                        free_dfvalue_space(old);
+                if (dfvalue_bit_p(value, entity) == left_out)
+                        continue;
+                if (left_out)
+                        reset_dfvalue_bit(full, compacted_entities[entity]);
+                else
+                        set_dfvalue_bit(full, compacted_entities[entity]);
         }
-        return change || change_at_in_out_of_stmt;
 }
 
+static void
+expand_compacted_dfi(void)
+{
+        int nid;
 
-static dfvalue
-combined_forward_edge_flow(basic_block bb)
-{                
-        dfvalue temp, new;
-        VEC(edge, gc) *edge_vec;
-        edge e;
-        edge_iterator ei;
-        basic_block pred_bb;
-
-        edge_vec = bb->preds;
-        temp = make_initialised_dfvalue(top_value_spec);
-
-        if (forward_edge_flow == &stop_flow_along_edge)
-                return temp;
-        
-        FOR_EACH_EDGE(e,ei,edge_vec)
+        for (nid=0; nid < number_of_nodes; nid++)
         {
-                pred_bb = e->src;
-                new = combine(temp,forward_edge_flow(pred_bb,bb));
-                if (temp)
-                        free_dfvalue_space(temp);
-                temp = new;        
+                expand_compacted_dfvalue(IN_nid(full_bb_dfi_storage->dfi,nid), IN_nid(current_pfbv_dfi,nid));
+                expand_compacted_dfvalue(OUT_nid(full_bb_dfi_storage->dfi,nid), OUT_nid(current_pfbv_dfi,nid));
         }
-        return temp;
 }
 
-static dfvalue
-combined_backward_edge_flow(basic_block bb)
-{                
-        dfvalue temp, new;
-        VEC(edge, gc) *edge_vec;
-        edge e;
-        edge_iterator ei;
-        basic_block succ_bb;
+/* Puts the solution back over the original universe, which is what the
+   rest of the driver and the clients work with. */
 
-        edge_vec = bb->succs;
-        temp = make_initialised_dfvalue(top_value_spec);
+static void
+end_entity_compaction(void)
+{
+        expand_compacted_dfi();
+        release_dfi_storage(bb_dfi_storage, number_of_nodes, no_value);
+        bb_dfi_storage = full_bb_dfi_storage;
+        current_pfbv_dfi = bb_dfi_storage->dfi;
+        relevant_pfbv_entity_count = full_entity_count;
+        full_bb_dfi_storage = NULL;
+        XDELETEVEC(compacted_entities);
+        compacted_entities = NULL;
+}
 
-        if (backward_edge_flow == &stop_flow_along_edge)
-                return temp;
+/*@Non-separable : START*/
+static int
+find_entity_component(int * parent, int entity)
+{
+        int root = entity, next;
 
-        FOR_EACH_EDGE(e,ei,edge_vec)
+        while (parent[root] != root)
+                root = parent[root];
+        while (parent[entity] != root)
         {
-                succ_bb = e->dest;
-                new = combine(temp,backward_edge_flow(bb,succ_bb));
-                if (temp)
-                        free_dfvalue_space(temp);
-                temp = new;        
-        }                
-        return temp;
+                next = parent[entity];
+                parent[entity] = root;
+                entity = next;
+        }
+        return root;
 }
 
 static void
-preserve_dfi(dfi_to_be_preserved preserve)
+couple_entities_of_transfer(int * parent, stmt_transfer * transfer)
 {
-        int iter;
-        
-        switch (preserve)
-        {        
-                case no_value:
-                        for (iter=0; iter < number_of_nodes; iter++)
-                        {                         
-                                if (GEN_nid(current_pfbv_dfi,iter))
-                                {
-                                        free_dfvalue_space(GEN_nid(current_pfbv_dfi,iter));
-                                        GEN_nid(current_pfbv_dfi,iter) =  NULL;
-                                }
-                                if (KILL_nid(current_pfbv_dfi,iter))
-                                {
-                                        free_dfvalue_space(KILL_nid(current_pfbv_dfi,iter));
-                                        KILL_nid(current_pfbv_dfi,iter) = NULL;
-                                }
-                                if (IN_nid(current_pfbv_dfi,iter))
-                                {
-                                        free_dfvalue_space(IN_nid(current_pfbv_dfi,iter));
-                                        IN_nid(current_pfbv_dfi,iter) = NULL;
-                                }
-                                if (OUT_nid(current_pfbv_dfi,iter))
-                                {
-                                        free_dfvalue_space(OUT_nid(current_pfbv_dfi,iter));
-                                        OUT_nid(current_pfbv_dfi,iter) = NULL;
-                                }
-                        }
-                        if (current_pfbv_dfi)
-                                ggc_free(current_pfbv_dfi);
-                        current_pfbv_dfi = NULL;
-
-                        if(is_nonseparable) 
-                        {
-                                for (iter=0; iter < local_stmt_count; iter++)
-                                {
-                                        if (GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter))
-                                        {
-                                                free_dfvalue_space(GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter));
-                                                GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter) = NULL; 
-                                        }
-                                        if (KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter))
-                                        {
-                                                free_dfvalue_space(KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter));
-                                                KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter) = NULL; 
-                                        }
-                                        if (IN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter))
-                                        {
-                                                free_dfvalue_space(IN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter));
-                                                IN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter) = NULL; 
-                                        }
-                                        if (OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter))
-                                        {
-                                                free_dfvalue_space(OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter));
-                                                OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter) = NULL; 
-                                        }
-                                }
-                                if (current_pfbv_dfi_of_stmt)
-                                        ggc_free(current_pfbv_dfi_of_stmt);
-                                current_pfbv_dfi_of_stmt = NULL;
-                        }
-                        break;
-                case global_only:
-                        for (iter=0; iter < number_of_nodes; iter++)
-                        {                         
-                                if (GEN_nid(current_pfbv_dfi,iter))
-                                {
-                                        free_dfvalue_space(GEN_nid(current_pfbv_dfi,iter));
-                                        GEN_nid(current_pfbv_dfi,iter) =  NULL;
-                                }
-                                if (KILL_nid(current_pfbv_dfi,iter))
-                                {
-                                        free_dfvalue_space(KILL_nid(current_pfbv_dfi,iter));
-                                        KILL_nid(current_pfbv_dfi,iter) = NULL;
-                                }
-                        }
-                        if(is_nonseparable) 
-                        {
-                                for (iter=0; iter < local_stmt_count; iter++)
-                                {
-                                        if (GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter))
-                                        {
-                                                free_dfvalue_space(GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter));
-                                                GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter) = NULL; 
-                                        }
-                                        if (KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter))
-                                        {
-                                                free_dfvalue_space(KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter));
-                                                KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter) = NULL; 
-                                        }
-                                }
-                        }
-                        break;
+        int entities[4], count = 0, k;
 
-                case all:
-                        break;
-                
-                default:
-                        report_dfa_spec_error("Wrong choice of values to be preserved (Function preserve_dfi)");
-                        break;
+        if (transfer->effect[0] == -1 && transfer->effect[1] == -1)
+                return;
+        for (k = 0; k < 2; k++)
+        {
+                if (transfer->test[k] != -1)
+                        entities[count++] = transfer->test[k];
+                if (transfer->effect[k] != -1)
+                        entities[count++] = transfer->effect[k];
         }
+        for (k = 1; k < count; k++)
+                parent[find_entity_component(parent, entities[k])] = find_entity_component(parent, entities[0]);
 }
 
+/* Numbers the subproblems of the entities in subproblem_of_entity and
+   returns how many there are. The components are packed, in the order
+   of their least entities, into subproblems of at most SBITMAP_ELT_BITS
+   entities, except that a larger component makes a subproblem of its
+   own. */
 
-static void
-create_dfi_space(int number_of_nodes)
+static int
+partition_entity_universe(int * subproblem_of_entity)
 {
-        int iter;
-
-
-        current_pfbv_dfi = (pfbv_dfi **)ggc_alloc_cleared(sizeof(pfbv_dfi*)*number_of_nodes);
-
-        for (iter=0; iter < number_of_nodes; iter++)
-        {         
+        int count = relevant_pfbv_entity_count;
+        int * parent = XNEWVEC(int, MAX(count,1));
+        int * size = XCNEWVEC(int, MAX(count,1));
+        int entity, root, iter, subproblems = 0, filled = SBITMAP_ELT_BITS;
+
+        for (entity = 0; entity < count; entity++)
+                parent[entity] = entity;
+        for (iter = 0; iter < local_stmt_count; iter++)
+        {
+                couple_entities_of_transfer(parent, &gen_transfer_of_stmt[iter]);
+                couple_entities_of_transfer(parent, &kill_transfer_of_stmt[iter]);
+        }
+        for (entity = 0; entity < count; entity++)
+        {
+                size[find_entity_component(parent, entity)]++;
+                subproblem_of_entity[entity] = -1;
+        }
 
-                /* We use nid to access DFI because for nid 0 and 1, bb is NULL */
+        for (entity = 0; entity < count; entity++)
+        {
+                root = find_entity_component(parent, entity);
+                if (subproblem_of_entity[root] == -1)
+                {
+                        if (filled + size[root] > SBITMAP_ELT_BITS)
+                        {
+                                subproblems++;
+                                filled = 0;
+                        }
+                        filled += size[root];
+                        subproblem_of_entity[root] = subproblems - 1;
+                }
+                subproblem_of_entity[entity] = subproblem_of_entity[root];
+        }
 
-                DFI_nid(current_pfbv_dfi,iter) =  (pfbv_dfi *)ggc_alloc_cleared(sizeof(pfbv_dfi));
+        XDELETEVEC(parent);
+        XDELETEVEC(size);
+        return subproblems;
+}
 
-                IN_nid(current_pfbv_dfi,iter) =  make_initialised_dfvalue(top_value_spec);
-                OUT_nid(current_pfbv_dfi,iter) =  make_initialised_dfvalue(top_value_spec);
+/* The transfer full over the entities of subproblem, numbered by
+   local_entity. A transfer that tests entities is coupled with them,
+   but a constant one (see compile_const_stmt_transfer) may generate or
+   kill entities of several subproblems, and keeps those of subproblem;
+   a transfer over other entities does nothing. */
 
-                /* Allocation and initialisation for local properties is
-                   done independently.
-                */
-                GEN_nid(current_pfbv_dfi,iter) =  NULL;
-                KILL_nid(current_pfbv_dfi,iter) =  NULL;
+static void
+localise_stmt_transfer(stmt_transfer * local, stmt_transfer * full, const int * subproblem_of_entity,
+                       const int * local_entity, int subproblem)
+{
+        int k;
 
+        *local = *full;
+        for (k = 0; k < 2; k++)
+        {
+                local->effect[k] = -1;
+                if (full->effect[k] != -1 && subproblem_of_entity[full->effect[k]] == subproblem)
+                        local->effect[k] = local_entity[full->effect[k]];
+        }
+        for (k = 0; k < 2; k++)
+        {
+                local->test[k] = -1;
+                if (full->test[k] != -1 && (local->effect[0] != -1 || local->effect[1] != -1))
+                        local->test[k] = local_entity[full->test[k]];
         }
 }
 
+static void
+gather_entities_of_subproblem(dfvalue value, dfvalue full, const int * entities, int count)
+{
+        int k;
 
-/********** Default node and edge flow functions   *************/
+        for (k = 0; k < count; k++)
+                if (dfvalue_bit_p(full, entities[k]))
+                        set_dfvalue_bit(value, k);
+        compute_dfvalue_span(value);
+}
 
-dfvalue
-identity_forward_edge_flow(basic_block src, basic_block dest)
+static void
+scatter_entities_of_subproblem(dfvalue full, dfvalue value, const int * entities, int count)
 {
-        return CURRENT_OUT(src);
+        int k;
+
+        for (k = 0; k < count; k++)
+        {
+                if (dfvalue_bit_p(value, k))
+                        set_dfvalue_bit(full, entities[k]);
+                else
+                        reset_dfvalue_bit(full, entities[k]);
+        }
+}
+
+/* Solves a non-separable analysis one subproblem at a time if its
+   universe splits into more than one. Returns false, leaving the
+   analysis to perform_pfbvdfa, otherwise. */
+
+static bool
+solve_entity_components(struct gimple_pfbv_dfa_spec dfa_spec)
+{
+        stmt_transfer * full_gen_transfers = gen_transfer_of_stmt;
+        stmt_transfer * full_kill_transfers = kill_transfer_of_stmt;
+        stmt_transfer * full_const_gen_transfers = const_gen_transfer_of_stmt;
+        stmt_transfer * full_const_kill_transfers = const_kill_transfer_of_stmt;
+        dfi_storage * full_stmt_dfi_storage = stmt_dfi_storage;
+        dfvalue_slab full_entry = stmt_replay ? stmt_replay->entry : NULL;
+        dfvalue_slab full_exit = stmt_replay ? stmt_replay->exit : NULL;
+        int * subproblem_of_entity, * first_entity, * next_entity, * entities, * local_entity;
+        int * row_of_bb;
+        int subproblems, subproblem, entity, count, iter, nid;
+
+        if (!partition_entities || !is_nonseparable || !gen_transfer_of_stmt)
+                return false;
+
+        subproblem_of_entity = XNEWVEC(int, MAX(relevant_pfbv_entity_count,1));
+        subproblems = partition_entity_universe(subproblem_of_entity);
+        if (subproblems <= 1)
+        {
+                XDELETEVEC(subproblem_of_entity);
+                return false;
+        }
+
+        print_initial_dfi();
+
+        /* The entities of subproblem s are entities[first_entity[s]] up to
+           entities[first_entity[s+1]-1], in increasing order */
+        full_entity_count = relevant_pfbv_entity_count;
+        full_bb_dfi_storage = bb_dfi_storage;
+        first_entity = XCNEWVEC(int, subproblems + 1);
+        next_entity = XNEWVEC(int, subproblems);
+        entities = XNEWVEC(int, full_entity_count);
+        local_entity = XNEWVEC(int, full_entity_count);
+        for (entity = 0; entity < full_entity_count; entity++)
+                first_entity[subproblem_of_entity[entity] + 1]++;
+        for (subproblem = 0; subproblem < subproblems; subproblem++)
+        {
+                first_entity[subproblem + 1] += first_entity[subproblem];
+                next_entity[subproblem] = first_entity[subproblem];
+        }
+        for (entity = 0; entity < full_entity_count; entity++)
+        {
+                subproblem = subproblem_of_entity[entity];
+                local_entity[entity] = next_entity[subproblem] - first_entity[subproblem];
+                entities[next_entity[subproblem]++] = entity;
+        }
+
+        gen_transfer_of_stmt = XNEWVEC(stmt_transfer, MAX(local_stmt_count,1));
+        kill_transfer_of_stmt = XNEWVEC(stmt_transfer, MAX(local_stmt_count,1));
+        if (stmt_replay)
+        {
+                const_gen_transfer_of_stmt = XNEWVEC(stmt_transfer, MAX(local_stmt_count,1));
+                const_kill_transfer_of_stmt = XNEWVEC(stmt_transfer, MAX(local_stmt_count,1));
+                connect_stmt_replay();
+        }
+        row_of_bb = row_order_of_bbs(traversal_order);
+        solving_components = true;
+        component_count_name = NULL;
+        component_count = 0;
+
+        for (subproblem = 0; subproblem < subproblems; subproblem++)
+        {
+                count = first_entity[subproblem + 1] - first_entity[subproblem];
+
+                free_dfvalue_pool();
+                relevant_pfbv_entity_count = count;
+                create_dfvalue_pool(dfa_spec.representation);
+                initialise_special_values(dfa_spec);
+
+                bb_dfi_storage = create_dfi_space(number_of_nodes, row_of_bb);
+                current_pfbv_dfi = bb_dfi_storage->dfi;
+                if (stmt_replay)
+                {
+                        stmt_replay->entry = make_dfvalue_slab(number_of_nodes, top_value_spec);
+                        stmt_replay->exit = make_dfvalue_slab(number_of_nodes, top_value_spec);
+                        for (nid = 0; nid < number_of_nodes; nid++)
+                                stmt_replay->entry_of_bb[nid] = NULL;
+                        forget_replayed_blocks(stmt_replay, -1);
+                }
+                else
+                {
+                        stmt_dfi_storage = create_dfi_space(local_stmt_count, NULL);
+                        current_pfbv_dfi_of_stmt = stmt_dfi_storage->dfi;
+                }
+                for (iter = 0; iter < local_stmt_count; iter++)
+                {
+                        if (stmt_replay)
+                        {
+                                localise_stmt_transfer(&const_gen_transfer_of_stmt[iter], 
+                                                       &full_const_gen_transfers[iter],
+                                                       subproblem_of_entity, local_entity, subproblem);
+                                localise_stmt_transfer(&const_kill_transfer_of_stmt[iter], 
+                                                       &full_const_kill_transfers[iter],
+                                                       subproblem_of_entity, local_entity, subproblem);
+                        }
+                        else
+                        {
+                                gather_entities_of_subproblem(GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter),
+                                                              GEN_OF_STMT_nid(full_stmt_dfi_storage->dfi,iter),
+                                                              entities + first_entity[subproblem], count);
+                                gather_entities_of_subproblem(KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter),
+                                                              KILL_OF_STMT_nid(full_stmt_dfi_storage->dfi,iter),
+                                                              entities + first_entity[subproblem], count);
+                        }
+                        localise_stmt_transfer(&gen_transfer_of_stmt[iter], &full_gen_transfers[iter],
+                                               subproblem_of_entity, local_entity, subproblem);
+                        localise_stmt_transfer(&kill_transfer_of_stmt[iter], &full_kill_transfers[iter],
+                                               subproblem_of_entity, local_entity, subproblem);
+                }
+                sbitmap_zero(replayed_bbs);
+
+                perform_pfbvdfa();
+
+                for (iter = 0; iter < local_stmt_count && !stmt_replay; iter++)
+                {
+                        scatter_entities_of_subproblem(IN_OF_STMT_nid(full_stmt_dfi_storage->dfi,iter),
+                                                       IN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter),
+                                                       entities + first_entity[subproblem], count);
+                        scatter_entities_of_subproblem(OUT_OF_STMT_nid(full_stmt_dfi_storage->dfi,iter),
+                                                       OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter),
+                                                       entities + first_entity[subproblem], count);
+                }
+                for (nid = 0; nid < number_of_nodes && stmt_replay; nid++)
+                {
+                        if (!stmt_replay->entry_of_bb[nid])
+                                continue;
+                        scatter_entities_of_subproblem(dfvalue_of_slab(full_entry, nid),
+                                                       stmt_replay->entry_of_bb[nid],
+                                                       entities + first_entity[subproblem], count);
+                        scatter_entities_of_subproblem(dfvalue_of_slab(full_exit, nid),
+                                                       dfvalue_of_slab(stmt_replay->exit, nid),
+                                                       entities + first_entity[subproblem], count);
+                }
+                for (nid = 0; nid < number_of_nodes; nid++)
+                {
+                        scatter_entities_of_subproblem(IN_nid(full_bb_dfi_storage->dfi,nid), 
+                                                       IN_nid(current_pfbv_dfi,nid),
+                                                       entities + first_entity[subproblem], count);
+                        scatter_entities_of_subproblem(OUT_nid(full_bb_dfi_storage->dfi,nid), 
+                                                       OUT_nid(current_pfbv_dfi,nid),
+                                                       entities + first_entity[subproblem], count);
+                }
+                if (stmt_replay)
+                {
+                        free_dfvalue_slab(stmt_replay->entry);
+                        free_dfvalue_slab(stmt_replay->exit);
+                }
+                else
+                        release_dfi_storage(stmt_dfi_storage, local_stmt_count, no_value);
+                release_dfi_storage(bb_dfi_storage, number_of_nodes, no_value);
+        }
+        solving_components = false;
+
+        free_dfvalue_pool();
+        relevant_pfbv_entity_count = full_entity_count;
+        create_dfvalue_pool(dfa_spec.representation);
+        initialise_special_values(dfa_spec);
+        bb_dfi_storage = full_bb_dfi_storage;
+        current_pfbv_dfi = bb_dfi_storage->dfi;
+        stmt_dfi_storage = full_stmt_dfi_storage;
+        current_pfbv_dfi_of_stmt = stmt_dfi_storage->dfi;
+        full_bb_dfi_storage = NULL;
+
+        XDELETEVEC(gen_transfer_of_stmt);
+        XDELETEVEC(kill_transfer_of_stmt);
+        gen_transfer_of_stmt = full_gen_transfers;
+        kill_transfer_of_stmt = full_kill_transfers;
+        if (stmt_replay)
+        {
+                XDELETEVEC(const_gen_transfer_of_stmt);
+                XDELETEVEC(const_kill_transfer_of_stmt);
+                const_gen_transfer_of_stmt = full_const_gen_transfers;
+                const_kill_transfer_of_stmt = full_const_kill_transfers;
+                connect_stmt_replay();
+                stmt_replay->entry = full_entry;
+                stmt_replay->exit = full_exit;
+                for (nid = 0; nid < number_of_nodes; nid++)
+                        if (stmt_replay->entry_of_bb[nid])
+                                stmt_replay->entry_of_bb[nid] = dfvalue_of_slab(full_entry, nid);
+                forget_replayed_blocks(stmt_replay, -1);
+        }
+        XDELETEVEC(row_of_bb);
+        XDELETEVEC(subproblem_of_entity);
+        XDELETEVEC(first_entity);
+        XDELETEVEC(next_entity);
+        XDELETEVEC(entities);
+        XDELETEVEC(local_entity);
+
+        print_final_dfi(component_count_name, component_count);
+        if (flag_gdfa_details)
+                fprintf(dump_file, "\n Independent subproblems = %d *******\n", subproblems);
+        return true;
+}
+/*@Non-separable : END*/
+
+/* The basic blocks to be solved are those visited by a sweep of
+   FOR_EACH_BB_IN_SPECIFIED_TRAVERSAL_ORDER. The solvers visit them in
+   the solution order: the reverse postorder of the CFG for forward
+   analyses, and for backward and bidirectional analyses the reverse
+   postorder of the reverse CFG, followed by the basic blocks that are
+   not reached by the depth first traversal of the reverse CFG in the
+   sweep order. The round robin solver sweeps backward analyses in the
+   reverse of the forward order unless REVERSE_CFG_ROUND_ROBIN is set. 
+*/
+static sbitmap bbs_to_be_solved = NULL;
+static int bbs_to_be_solved_count = 0;
+static int * solution_order_of_bb = NULL;
+static basic_block * bb_in_solution_order = NULL;
+
+static void
+init_solution_order(void)
+{
+        int visit_bb=0, position, order=0;
+        varray_type ordered_basic_blocks = NULL; 
+        basic_block bb;
+
+        bbs_to_be_solved = sbitmap_alloc(number_of_nodes);
+        sbitmap_zero(bbs_to_be_solved);
+        bbs_to_be_solved_count = 0;
+        solution_order_of_bb = XNEWVEC(int, number_of_nodes);
+        bb_in_solution_order = XNEWVEC(basic_block, number_of_nodes);
+        for (position = 0; position < number_of_nodes; position++)
+                solution_order_of_bb[position] = -1;
+
+        FOR_EACH_BB_IN_SPECIFIED_TRAVERSAL_ORDER  
+        {         
+                bb = VARRAY_BB(dfs_ordered_basic_blocks,visit_bb);
+                if(bb)
+                {
+                        SET_BIT(bbs_to_be_solved, find_index_bb(bb));
+                        bbs_to_be_solved_count++;
+                }
+        }
+
+        if (traversal_order == FORWARD)
+                ordered_basic_blocks = dfs_ordered_basic_blocks;
+        else if (solver != ROUND_ROBIN || REVERSE_CFG_ROUND_ROBIN)
+                ordered_basic_blocks = reverse_dfs_ordered_basic_blocks;
+
+        for (position = 0; ordered_basic_blocks && position < number_of_nodes; position++)
+        {
+                bb = VARRAY_BB(ordered_basic_blocks,position);
+                if (bb && TEST_BIT(bbs_to_be_solved, find_index_bb(bb)))
+                {
+                        solution_order_of_bb[find_index_bb(bb)] = order;
+                        bb_in_solution_order[order++] = bb;
+                }
+        }
+
+        FOR_EACH_BB_IN_SPECIFIED_TRAVERSAL_ORDER  
+        {         
+                bb = VARRAY_BB(dfs_ordered_basic_blocks,visit_bb);
+                if (bb && solution_order_of_bb[find_index_bb(bb)] < 0)
+                {
+                        solution_order_of_bb[find_index_bb(bb)] = order;
+                        bb_in_solution_order[order++] = bb;
+                }
+        }
+}
+
+static void
+free_solution_order(void)
+{
+        sbitmap_free(bbs_to_be_solved);
+        XDELETEVEC(solution_order_of_bb);
+        XDELETEVEC(bb_in_solution_order);
+        bbs_to_be_solved = NULL;
+        solution_order_of_bb = NULL;
+        bb_in_solution_order = NULL;
+}
+
+static void 
+perform_pfbvdfa(void)
+{
+        init_solution_order();
+        create_scratch_dfvalues();
+
+        if (use_tiles())
+                perform_tiled_pfbvdfa();
+        else switch (solver)
+        {
+                case ROUND_ROBIN:
+                        perform_round_robin_pfbvdfa();
+                        break;
+                case WORKLIST:
+                case PRIORITY_WORKLIST:
+                        perform_worklist_pfbvdfa();
+                        break;
+                case WEAK_TOPOLOGICAL_ORDER:
+                        perform_wto_pfbvdfa();
+                        break;
+                case HIERARCHICAL:
+                        perform_hierarchical_pfbvdfa();
+                        break;
+                case ELIMINATION:
+                        perform_elimination_pfbvdfa();
+                        break;
+                default:
+                        report_dfa_spec_error ("Solver can only be ROUND_ROBIN, WORKLIST, PRIORITY_WORKLIST, WEAK_TOPOLOGICAL_ORDER, HIERARCHICAL, or ELIMINATION (Function perform_pfbvdfa)");
+                        break;
+        }
+
+        free_scratch_dfvalues();
+        free_solution_order();
+}
+
+static void 
+perform_round_robin_pfbvdfa(void)
+{
+        int order, iteration_number=0;
+        basic_block bb;
+        bool change, change_at_in, change_at_out;
+ 
+	print_initial_dfi(); 
+
+        do{        
+                iteration_number++;
+                change = false;
+                for (order = 0; order < bbs_to_be_solved_count; order++)
+                {         
+                        bb = bb_in_solution_order[order];
+                        visit_bb_in_traversal_order(bb, &change_at_in, &change_at_out);
+                        change = change || change_at_in || change_at_out;
+                }
+		print_per_iteration_dfi(iteration_number); 
+        } while(change);
+
+	print_final_dfi("Iterations", iteration_number);
+
+}
+
+/* The FIFO work list is a circular queue of basic blocks. A basic block
+   is queued at most once at any time, hence number_of_nodes slots
+   suffice. 
+
+   The priority work list is a bit vector of positions in the solution
+   order. The basic block with the least position greater than that of
+   the last visited basic block is visited next; when there is none, a
+   new round starts from the least position. Thus a round is a sweep
+   that skips the basic blocks whose inputs have not changed;
+   worklist_skipped counts the positions of the rounds that were
+   passed over.
+
+   The weak topological order solver does not keep a queue. It uses
+   bbs_in_worklist as the set of dirty basic blocks, i.e. those whose
+   inputs have changed since they were last visited.
+
+   Only the basic blocks to be solved are ever queued. 
+*/
+static basic_block * worklist = NULL;
+static int worklist_head = 0;
+static int worklist_length = 0;
+static sbitmap bbs_in_worklist = NULL;
+static unsigned int worklist_cursor = 0;
+static int worklist_rounds = 0;
+static int worklist_skipped = 0;
+
+static void
+add_bb_to_worklist(basic_block bb)
+{
+        int index = find_index_bb(bb);
+        int position;
+
+        if (!TEST_BIT(bbs_to_be_solved, index))
+                return;
+
+        if (solver == PRIORITY_WORKLIST)
+                position = solution_order_of_bb[index];
+        else
+                position = index;
+
+        if (TEST_BIT(bbs_in_worklist, position))
+                return;
+
+        SET_BIT(bbs_in_worklist, position);
+        if (solver == WORKLIST)
+                worklist[(worklist_head + worklist_length) % number_of_nodes] = bb;
+        worklist_length++;
+}
+
+static basic_block
+remove_bb_from_worklist(void)
+{
+        basic_block bb;
+        sbitmap_iterator sbi;
+        unsigned int position = 0;
+
+        worklist_length--;
+
+        if (solver != PRIORITY_WORKLIST)
+        {
+                bb = worklist[worklist_head];
+                worklist_head = (worklist_head + 1) % number_of_nodes;
+                RESET_BIT(bbs_in_worklist, find_index_bb(bb));
+                return bb;
+        }
+
+        if (worklist_cursor < (unsigned int) number_of_nodes)
+                sbitmap_iter_init(&sbi, bbs_in_worklist, worklist_cursor, &position);
+        if (worklist_cursor >= (unsigned int) number_of_nodes 
+            || !sbitmap_iter_cond(&sbi, &position))
+        {
+                worklist_rounds++;
+                worklist_skipped += bbs_to_be_solved_count - (int) worklist_cursor;
+                worklist_cursor = 0;
+                sbitmap_iter_init(&sbi, bbs_in_worklist, 0, &position);
+                sbitmap_iter_cond(&sbi, &position);
+        }
+
+        worklist_skipped += position - worklist_cursor;
+        RESET_BIT(bbs_in_worklist, position);
+        worklist_cursor = position + 1;
+        return bb_in_solution_order[position];
+}
+
+static void 
+perform_worklist_pfbvdfa(void)
+{
+        int order, visit_count=0;
+        basic_block bb;
+        bool change_at_in, change_at_out;
+ 
+	print_initial_dfi(); 
+
+        worklist_head = 0;
+        worklist_length = 0;
+        worklist_cursor = 0;
+        worklist_rounds = 1;
+        worklist_skipped = 0;
+        bbs_in_worklist = sbitmap_alloc(number_of_nodes);
+        sbitmap_zero(bbs_in_worklist);
+        if (solver != PRIORITY_WORKLIST)
+                worklist = XNEWVEC(basic_block, number_of_nodes);
+
+        for (order = 0; order < bbs_to_be_solved_count; order++)
+                add_bb_to_worklist(bb_in_solution_order[order]);
+
+        while (worklist_length > 0)
+        {
+                bb = remove_bb_from_worklist();
+                visit_count++;
+                visit_bb_in_traversal_order(bb, &change_at_in, &change_at_out);
+                add_dependent_bbs_to_worklist(bb, change_at_in, change_at_out);
+        }
+
+	print_final_dfi("Basic Block Visits", visit_count);
+
+        /* The rest of the last round is passed over too */
+        if (flag_gdfa_details && solver == PRIORITY_WORKLIST)
+                fprintf(dump_file, "\n Rounds = %d, Visits skipped = %d *******\n",
+                        worklist_rounds, 
+                        worklist_skipped + bbs_to_be_solved_count - (int) worklist_cursor);
+
+        if (worklist)
+                XDELETEVEC(worklist);
+        worklist = NULL;
+        sbitmap_free(bbs_in_worklist);
+        bbs_in_worklist = NULL;
+}
+
+/* Weak topological order (Bourdoncle) of the basic blocks to be solved.
+   The order is built over the CFG for forward analyses and over the
+   reverse CFG otherwise, by a recursive decomposition into strongly
+   connected components: a component that is a single basic block
+   without a self loop is a vertex; otherwise the member with the least
+   position in the solution order becomes the head of the component and
+   the remaining members are decomposed again. Hence the recursion depth
+   is the loop nesting depth; the strongly connected components at each
+   level are found by a non recursive Tarjan traversal.
+
+   The order is kept in a flat array of positions in the solution order.
+   A head is followed by the elements of its component, and
+   wto_component_end of the head is the index just past the component;
+   it is -1 for a vertex.
+
+   Every edge either goes forward in this order or ends at the head of a
+   component containing its source. Solving a component visits its head
+   and then its elements, and repeats this until the head is not dirty
+   after the elements have been visited. Dirty basic blocks are the only
+   ones visited, so a component that has stabilised is passed over.
+   Flow functions that depend on values against the direction of the
+   analysis (as in partial redundancy elimination) may leave basic
+   blocks dirty after the whole order is solved; the order is solved
+   again until no basic block is dirty. 
+*/
+static int * wto = NULL;
+static int * wto_component_end = NULL;
+static int wto_length = 0;
+
+static int * wto_level = NULL;
+static int * tarjan_number = NULL;
+static int * tarjan_lowlink = NULL;
+static sbitmap tarjan_on_stack = NULL;
+static int * tarjan_stack = NULL;
+static int * tarjan_call_stack = NULL;
+static edge_iterator * tarjan_edge_stack = NULL;
+
+static int wto_visit_count = 0;
+
+static edge_iterator
+wto_edges_of_position(int position)
+{
+        basic_block bb = bb_in_solution_order[position];
+
+        if (traversal_order == FORWARD)
+                return ei_start(bb->succs);
+        else
+                return ei_start(bb->preds);
+}
+
+/* The position of the basic block that the edge leads to in the
+   direction of the analysis, if it is in the subgraph at level;
+   -1 otherwise. */
+static int
+wto_target_position(edge e, int level)
+{
+        basic_block bb = (traversal_order == FORWARD) ? e->dest : e->src;
+        int position;
+
+        if (!TEST_BIT(bbs_to_be_solved, find_index_bb(bb)))
+                return -1;
+        position = solution_order_of_bb[find_index_bb(bb)];
+        return (wto_level[position] == level) ? position : -1;
+}
+
+static bool
+wto_has_self_loop(int position, int level)
+{
+        edge e;
+        edge_iterator ei;
+
+        for (ei = wto_edges_of_position(position); !ei_end_p(ei); ei_next(&ei))
+        {
+                e = ei_edge(ei);
+                if (wto_target_position(e, level) == position)
+                        return true;
+        }
+        return false;
+}
+
+static int
+compare_positions(const void *p1, const void *p2)
+{
+        return *(const int *) p1 - *(const int *) p2;
+}
+
+/* Append to wto the weak topological order of the subgraph induced by
+   members, an ascending array of member_count positions whose wto_level
+   is level. */
+static void
+build_wto_of_subgraph(int *members, int member_count, int level)
+{
+        int *scc_members, *scc_end, *inner_members;
+        int scc_count = 0, scc_fill = 0, number = 0;
+        int tarjan_top = 0, call_top = 0;
+        int i, k, v, w, head, first, last, inner_count, component;
+
+        scc_members = XNEWVEC(int, member_count);
+        scc_end = XNEWVEC(int, member_count);
+
+        for (i = 0; i < member_count; i++)
+                tarjan_number[members[i]] = -1;
+
+        for (i = 0; i < member_count; i++)
+        {
+                if (tarjan_number[members[i]] >= 0)
+                        continue;
+
+                v = members[i];
+                tarjan_number[v] = tarjan_lowlink[v] = number++;
+                tarjan_stack[tarjan_top++] = v;
+                SET_BIT(tarjan_on_stack, v);
+                tarjan_call_stack[call_top] = v;
+                tarjan_edge_stack[call_top++] = wto_edges_of_position(v);
+
+                while (call_top > 0)
+                {
+                        v = tarjan_call_stack[call_top - 1];
+                        if (!ei_end_p(tarjan_edge_stack[call_top - 1]))
+                        {
+                                w = wto_target_position(ei_edge(tarjan_edge_stack[call_top - 1]), level);
+                                ei_next(&tarjan_edge_stack[call_top - 1]);
+                                if (w < 0)
+                                        continue;
+                                if (tarjan_number[w] < 0)
+                                {
+                                        tarjan_number[w] = tarjan_lowlink[w] = number++;
+                                        tarjan_stack[tarjan_top++] = w;
+                                        SET_BIT(tarjan_on_stack, w);
+                                        tarjan_call_stack[call_top] = w;
+                                        tarjan_edge_stack[call_top++] = wto_edges_of_position(w);
+                                }
+                                else if (TEST_BIT(tarjan_on_stack, w) 
+                                         && tarjan_number[w] < tarjan_lowlink[v])
+                                        tarjan_lowlink[v] = tarjan_number[w];
+                                continue;
+                        }
+
+                        call_top--;
+                        if (call_top > 0)
+                        {
+                                w = tarjan_call_stack[call_top - 1];
+                                if (tarjan_lowlink[v] < tarjan_lowlink[w])
+                                        tarjan_lowlink[w] = tarjan_lowlink[v];
+                        }
+
+                        if (tarjan_lowlink[v] == tarjan_number[v])
+                        {
+                                do {
+                                        w = tarjan_stack[--tarjan_top];
+                                        RESET_BIT(tarjan_on_stack, w);
+                                        scc_members[scc_fill++] = w;
+                                } while (w != v);
+                                scc_end[scc_count++] = scc_fill;
+                        }
+                }
+        }
+
+        /* Tarjan finds the components in reverse topological order. */
+        for (k = scc_count - 1; k >= 0; k--)
+        {
+                first = (k > 0) ? scc_end[k - 1] : 0;
+                last = scc_end[k];
+
+                if (last - first == 1 && !wto_has_self_loop(scc_members[first], level))
+                {
+                        wto_component_end[wto_length] = -1;
+                        wto[wto_length++] = scc_members[first];
+                        continue;
+                }
+
+                head = scc_members[first];
+                for (i = first + 1; i < last; i++)
+                        if (scc_members[i] < head)
+                                head = scc_members[i];
+
+                inner_members = XNEWVEC(int, last - first);
+                inner_count = 0;
+                for (i = first; i < last; i++)
+                        if (scc_members[i] != head)
+                        {
+                                wto_level[scc_members[i]] = level + 1;
+                                inner_members[inner_count++] = scc_members[i];
+                        }
+                qsort(inner_members, inner_count, sizeof(int), compare_positions);
+
+                component = wto_length;
+                wto[wto_length++] = head;
+                build_wto_of_subgraph(inner_members, inner_count, level + 1);
+                wto_component_end[component] = wto_length;
+
+                XDELETEVEC(inner_members);
+        }
+
+        XDELETEVEC(scc_members);
+        XDELETEVEC(scc_end);
+}
+
+static void
+build_wto(void)
+{
+        int *members;
+        int position;
+
+        wto = XNEWVEC(int, bbs_to_be_solved_count);
+        wto_component_end = XNEWVEC(int, bbs_to_be_solved_count);
+        wto_level = XCNEWVEC(int, bbs_to_be_solved_count);
+        tarjan_number = XNEWVEC(int, bbs_to_be_solved_count);
+        tarjan_lowlink = XNEWVEC(int, bbs_to_be_solved_count);
+        tarjan_stack = XNEWVEC(int, bbs_to_be_solved_count);
+        tarjan_call_stack = XNEWVEC(int, bbs_to_be_solved_count);
+        tarjan_edge_stack = XNEWVEC(edge_iterator, bbs_to_be_solved_count);
+        tarjan_on_stack = sbitmap_alloc(bbs_to_be_solved_count);
+        sbitmap_zero(tarjan_on_stack);
+        wto_length = 0;
+
+        members = XNEWVEC(int, bbs_to_be_solved_count);
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+                members[position] = position;
+        build_wto_of_subgraph(members, bbs_to_be_solved_count, 0);
+        XDELETEVEC(members);
+
+        XDELETEVEC(wto_level);
+        XDELETEVEC(tarjan_number);
+        XDELETEVEC(tarjan_lowlink);
+        XDELETEVEC(tarjan_stack);
+        XDELETEVEC(tarjan_call_stack);
+        XDELETEVEC(tarjan_edge_stack);
+        sbitmap_free(tarjan_on_stack);
+        wto_level = tarjan_number = tarjan_lowlink = NULL;
+        tarjan_stack = tarjan_call_stack = NULL;
+        tarjan_edge_stack = NULL;
+        tarjan_on_stack = NULL;
+}
+
+static void
+free_wto(void)
+{
+        XDELETEVEC(wto);
+        XDELETEVEC(wto_component_end);
+        wto = wto_component_end = NULL;
+        wto_length = 0;
+}
+
+static void
+dump_wto_elements(FILE * file, int first, int last)
+{
+        int i = first;
+
+        while (i < last)
+        {
+                if (wto_component_end[i] < 0)
+                {
+                        fprintf(file, " %d", find_index_bb(bb_in_solution_order[wto[i]]));
+                        i++;
+                }
+                else
+                {
+                        fprintf(file, " (%d", find_index_bb(bb_in_solution_order[wto[i]]));
+                        dump_wto_elements(file, i + 1, wto_component_end[i]);
+                        fprintf(file, ")");
+                        i = wto_component_end[i];
+                }
+        }
+}
+
+static void
+visit_bb_if_dirty(basic_block bb)
+{
+        bool change_at_in, change_at_out;
+
+        if (!TEST_BIT(bbs_in_worklist, find_index_bb(bb)))
+                return;
+
+        RESET_BIT(bbs_in_worklist, find_index_bb(bb));
+        worklist_length--;
+        wto_visit_count++;
+        visit_bb_in_traversal_order(bb, &change_at_in, &change_at_out);
+        add_dependent_bbs_to_worklist(bb, change_at_in, change_at_out);
+}
+
+static void solve_wto_component(int head);
+
+static void
+solve_wto_elements(int first, int last)
+{
+        int i = first;
+
+        while (i < last)
+        {
+                if (wto_component_end[i] < 0)
+                {
+                        visit_bb_if_dirty(bb_in_solution_order[wto[i]]);
+                        i++;
+                }
+                else
+                {
+                        solve_wto_component(i);
+                        i = wto_component_end[i];
+                }
+        }
+}
+
+static void
+solve_wto_component(int head)
+{
+        basic_block head_bb = bb_in_solution_order[wto[head]];
+
+        do {
+                visit_bb_if_dirty(head_bb);
+                solve_wto_elements(head + 1, wto_component_end[head]);
+        } while (TEST_BIT(bbs_in_worklist, find_index_bb(head_bb)));
+}
+
+static void 
+perform_wto_pfbvdfa(void)
+{
+        int order, passes=0;
+ 
+	print_initial_dfi(); 
+
+        build_wto();
+        if (flag_gdfa_details)
+        {
+                fprintf(dump_file, "\n Weak topological order:");
+                dump_wto_elements(dump_file, 0, wto_length);
+                fprintf(dump_file, "\n");
+        }
+
+        worklist_length = 0;
+        wto_visit_count = 0;
+        bbs_in_worklist = sbitmap_alloc(number_of_nodes);
+        sbitmap_zero(bbs_in_worklist);
+        for (order = 0; order < bbs_to_be_solved_count; order++)
+                add_bb_to_worklist(bb_in_solution_order[order]);
+
+        while (worklist_length > 0)
+        {
+                passes++;
+                solve_wto_elements(0, wto_length);
+        }
+
+	print_final_dfi("Basic Block Visits", wto_visit_count);
+        if (flag_gdfa_details)
+                fprintf(dump_file, "\n Passes over the weak topological order = %d *******\n", passes);
+
+        sbitmap_free(bbs_in_worklist);
+        bbs_in_worklist = NULL;
+        free_wto();
+}
+
+/* Hierarchical solution of separable specs with the default gen-kill
+   flows. A flow function f(X) = GEN + (X - KILL) is represented by the
+   pair (GEN, KILL) with GEN and KILL disjoint; such functions are closed
+   under composition and confluence:
+
+        f2 o f1            = (GEN2 + (GEN1 - KILL2), KILL2 + (KILL1 - GEN2))
+        f1 INTERSECTION f2 = (GEN1 * GEN2, KILL1 + KILL2)
+        f1 UNION f2        = (GEN1 + GEN2, KILL1 * KILL2)
+
+   and since f o f = f, the closure of f is the confluence of f with the
+   identity (0, 0).
+
+   The weak topological order is used as the loop tree; for reducible
+   CFGs its components are the natural loops (of the reverse CFG for
+   backward analyses). For a component whose members other than the
+   head are entered only from within the component, the path function
+   of a member maps the value at the confluence side of the head to the
+   value at its own confluence side. These are computed bottom-up: the
+   path functions of an inner component are composed with the closure of
+   the inner component and the path function of its head, and the
+   closure of a component is that of the confluence of the flows along
+   its back edges. The value at the head is then the closure applied to
+   the confluence of the values entering the component, and each member
+   is solved once by applying its path function. Components that can be
+   entered elsewhere (irreducible regions) are solved iteratively, as are
+   the whole functions of specs that do not meet the requirements. 
+*/
+typedef struct gen_kill_function
+{
+        dfvalue gen;
+        dfvalue kill;
+} gen_kill_function;
+
+static gen_kill_function * transfer_function = NULL;
+static gen_kill_function * path_function = NULL;
+static gen_kill_function * closure_function = NULL;
+static int * wto_index_of_position = NULL;
+static dfvalue value_zeros = NULL;
+static dfvalue value_ones = NULL;
+
+static void
+free_function(gen_kill_function *f)
+{
+        if (f->gen)
+                free_dfvalue_space(f->gen);
+        if (f->kill)
+                free_dfvalue_space(f->kill);
+        f->gen = f->kill = NULL;
+}
+
+static gen_kill_function
+make_identity_function(void)
+{
+        gen_kill_function f;
+
+        f.gen = copy_dfvalue(value_zeros);
+        f.kill = copy_dfvalue(value_zeros);
+        return f;
+}
+
+static gen_kill_function
+make_constant_function(dfvalue value)
+{
+        gen_kill_function f;
+
+        f.gen = copy_dfvalue(value);
+        f.kill = a_plus_b_minus_c(value_zeros, value_ones, value);
+        return f;
+}
+
+static gen_kill_function
+meet_functions(gen_kill_function f1, gen_kill_function f2)
+{
+        gen_kill_function f;
+
+        if (confluence == INTERSECTION)
+        {
+                f.gen = intersect_dfvalues(f1.gen, f2.gen);
+                f.kill = union_dfvalues(f1.kill, f2.kill);
+        }
+        else
+        {
+                f.gen = union_dfvalues(f1.gen, f2.gen);
+                f.kill = intersect_dfvalues(f1.kill, f2.kill);
+        }
+        return f;
+}
+
+/* f2 o f1 */
+static gen_kill_function
+compose_functions(gen_kill_function f2, gen_kill_function f1)
+{
+        gen_kill_function f;
+
+        f.gen = a_plus_b_minus_c(f2.gen, f1.gen, f2.kill);
+        f.kill = a_plus_b_minus_c(f2.kill, f1.kill, f2.gen);
+        return f;
+}
+
+static gen_kill_function
+closure_of_function(gen_kill_function g)
+{
+        gen_kill_function f;
+
+        if (confluence == INTERSECTION)
+        {
+                f.gen = copy_dfvalue(value_zeros);
+                f.kill = copy_dfvalue(g.kill);
+        }
+        else
+        {
+                f.gen = copy_dfvalue(g.gen);
+                f.kill = copy_dfvalue(value_zeros);
+        }
+        return f;
+}
+
+static dfvalue
+apply_function(gen_kill_function f, dfvalue value)
+{
+        return a_plus_b_minus_c(f.gen, value, f.kill);
+}
+
+/* The node flow of bb, combined with the boundary information when bb
+   has no successors (forward analyses) or predecessors (backward
+   analyses). */
+static gen_kill_function
+make_transfer_function_of_bb(basic_block bb)
+{
+        gen_kill_function f, boundary, temp;
+
+        f.gen = copy_dfvalue(CURRENT_GEN(bb));
+        f.kill = a_plus_b_minus_c(value_zeros, CURRENT_KILL(bb), CURRENT_GEN(bb));
+
+        if ((traversal_order == FORWARD && !bb->succs) 
+            || (traversal_order != FORWARD && !bb->preds))
+        {
+                boundary = make_constant_function(traversal_order == FORWARD ? exit_info : entry_info);
+                temp = meet_functions(boundary, f);
+                free_function(&boundary);
+                free_function(&f);
+                f = temp;
+        }
+        return f;
+}
+
+static bool
+is_closed_form_solution_possible(void)
+{
+        if (is_nonseparable)
+                return false;
+
+        /* Unsolved basic blocks keep the value top, which must not
+           affect the confluence. */
+        if ((confluence == INTERSECTION && top_value_spec != ONES)
+            || (confluence == UNION && top_value_spec != ZEROS))
+                return false;
+
+        if (traversal_order == FORWARD)
+                return forward_edge_flow == &identity_forward_edge_flow
+                       && backward_edge_flow == &stop_flow_along_edge
+                       && forward_node_flow == &forward_gen_kill_node_flow
+                       && backward_node_flow == &stop_flow_along_node;
+        else if (traversal_order == BACKWARD)
+                return forward_edge_flow == &stop_flow_along_edge
+                       && backward_edge_flow == &identity_backward_edge_flow
+                       && forward_node_flow == &stop_flow_along_node
+                       && backward_node_flow == &backward_gen_kill_node_flow;
+        return false;
+}
+
+/* The edges along which bb receives values: from the predecessors in
+   forward analyses and from the successors otherwise. */
+static edge_iterator
+source_edges_of_bb(basic_block bb)
+{
+        if (traversal_order == FORWARD)
+                return ei_start(bb->preds);
+        else
+                return ei_start(bb->succs);
+}
+
+static basic_block
+source_of_edge(edge e)
+{
+        return (traversal_order == FORWARD) ? e->src : e->dest;
+}
+
+static int
+solution_position_of_bb(basic_block bb)
+{
+        if (!TEST_BIT(bbs_to_be_solved, find_index_bb(bb)))
+                return -1;
+        return solution_order_of_bb[find_index_bb(bb)];
+}
+
+static bool
+is_within_wto_range(int position, int first, int last)
+{
+        return wto_index_of_position[position] >= first 
+               && wto_index_of_position[position] < last;
+}
+
+static bool
+is_single_entry_wto_component(int head)
+{
+        int i, source, end = wto_component_end[head];
+        edge_iterator ei;
+
+        for (i = head + 1; i < end; )
+        {
+                for (ei = source_edges_of_bb(bb_in_solution_order[wto[i]]); !ei_end_p(ei); ei_next(&ei))
+                {
+                        source = solution_position_of_bb(source_of_edge(ei_edge(ei)));
+                        if (source >= 0 && !is_within_wto_range(source, head, end))
+                                return false;
+                }
+
+                if (wto_component_end[i] < 0)
+                        i++;
+                else if (!is_single_entry_wto_component(i))
+                        return false;
+                else
+                        i = wto_component_end[i];
+        }
+        return true;
+}
+
+/* The confluence of the flows into the basic block at position along
+   the edges from the solved basic blocks whose order index is within
+   [first, last) if within is true and outside it otherwise, as a
+   function of the value at the head of the enclosing component. */
+static gen_kill_function
+make_source_function(int position, int first, int last, bool within)
+{
+        gen_kill_function f, along_edge, temp;
+        edge_iterator ei;
+        int source;
+
+        f = make_constant_function(value_top);
+        for (ei = source_edges_of_bb(bb_in_solution_order[position]); !ei_end_p(ei); ei_next(&ei))
+        {
+                source = solution_position_of_bb(source_of_edge(ei_edge(ei)));
+                if (source < 0 || is_within_wto_range(source, first, last) != within)
+                        continue;
+
+                along_edge = compose_functions(transfer_function[source], path_function[source]);
+                temp = meet_functions(f, along_edge);
+                free_function(&along_edge);
+                free_function(&f);
+                f = temp;
+        }
+        return f;
+}
+
+static void
+summarise_wto_component(int head)
+{
+        int i, j, last, end = wto_component_end[head];
+        gen_kill_function entry, temp, back_edges;
+
+        for (i = head + 1; i < end; i = (wto_component_end[i] < 0) ? i + 1 : wto_component_end[i])
+                if (wto_component_end[i] >= 0)
+                        summarise_wto_component(i);
+
+        path_function[wto[head]] = make_identity_function();
+
+        for (i = head + 1; i < end; )
+        {
+                last = (wto_component_end[i] < 0) ? i + 1 : wto_component_end[i];
+                entry = make_source_function(wto[i], i, last, false);
+
+                if (wto_component_end[i] < 0)
+                {
+                        path_function[wto[i]] = entry;
+                        i++;
+                        continue;
+                }
+
+                temp = compose_functions(closure_function[wto[i]], entry);
+                free_function(&entry);
+                entry = temp;
+                for (j = i + 1; j < last; j++)
+                {
+                        temp = compose_functions(path_function[wto[j]], entry);
+                        free_function(&path_function[wto[j]]);
+                        path_function[wto[j]] = temp;
+                }
+                free_function(&path_function[wto[i]]);
+                path_function[wto[i]] = entry;
+                i = last;
+        }
+
+        back_edges = make_source_function(wto[head], head, end, true);
+        closure_function[wto[head]] = closure_of_function(back_edges);
+        free_function(&back_edges);
+}
+
+static dfvalue *
+confluence_side_of_bb(basic_block bb)
+{
+        return (traversal_order == FORWARD) ? &CURRENT_IN(bb) : &CURRENT_OUT(bb);
+}
+
+static dfvalue *
+node_flow_side_of_bb(basic_block bb)
+{
+        return (traversal_order == FORWARD) ? &CURRENT_OUT(bb) : &CURRENT_IN(bb);
+}
+
+static void
+solve_single_entry_wto_component(int head)
+{
+        int i, end = wto_component_end[head];
+        basic_block bb, head_bb = bb_in_solution_order[wto[head]];
+        dfvalue entering, temp, at_head;
+        edge_iterator ei;
+        basic_block source_bb;
+        int source;
+
+        summarise_wto_component(head);
+
+        entering = make_initialised_dfvalue(top_value_spec);
+        for (ei = source_edges_of_bb(head_bb); !ei_end_p(ei); ei_next(&ei))
+        {
+                source_bb = source_of_edge(ei_edge(ei));
+                source = solution_position_of_bb(source_bb);
+                if (source >= 0 && is_within_wto_range(source, head, end))
+                        continue;
+                temp = combine(entering, *node_flow_side_of_bb(source_bb));
+                free_dfvalue_space(entering);
+                entering = temp;
+        }
+        at_head = apply_function(closure_function[wto[head]], entering);
+        free_dfvalue_space(entering);
+
+        for (i = head; i < end; i++)
+        {
+                bb = bb_in_solution_order[wto[i]];
+                temp = apply_function(path_function[wto[i]], at_head);
+                copy_dfvalue_into(*confluence_side_of_bb(bb), temp);
+                free_dfvalue_space(temp);
+                temp = apply_function(transfer_function[wto[i]], *confluence_side_of_bb(bb));
+                copy_dfvalue_into(*node_flow_side_of_bb(bb), temp);
+                free_dfvalue_space(temp);
+                wto_visit_count++;
+
+                free_function(&path_function[wto[i]]);
+                if (wto_component_end[i] >= 0)
+                        free_function(&closure_function[wto[i]]);
+        }
+        free_dfvalue_space(at_head);
+}
+
+static void 
+perform_hierarchical_pfbvdfa(void)
+{
+        int i, end, position, summarised=0, iterated=0;
+        bool change_at_in, change_at_out;
+
+        if (!is_closed_form_solution_possible())
+        {
+                if (flag_gdfa_details)
+                        fprintf(dump_file, "\n Hierarchical solution is not possible, using the weak topological order\n");
+                perform_wto_pfbvdfa();
+                return;
+        }
+ 
+	print_initial_dfi(); 
+
+        build_wto();
+        wto_index_of_position = XNEWVEC(int, bbs_to_be_solved_count);
+        for (i = 0; i < wto_length; i++)
+                wto_index_of_position[wto[i]] = i;
+
+        value_zeros = make_initialised_dfvalue(ZEROS);
+        value_ones = make_initialised_dfvalue(ONES);
+        transfer_function = XCNEWVEC(gen_kill_function, bbs_to_be_solved_count);
+        path_function = XCNEWVEC(gen_kill_function, bbs_to_be_solved_count);
+        closure_function = XCNEWVEC(gen_kill_function, bbs_to_be_solved_count);
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+                transfer_function[position] = make_transfer_function_of_bb(bb_in_solution_order[position]);
+
+        worklist_length = 0;
+        wto_visit_count = 0;
+        bbs_in_worklist = sbitmap_alloc(number_of_nodes);
+        sbitmap_zero(bbs_in_worklist);
+
+        for (i = 0; i < wto_length; i = end)
+        {
+                if (wto_component_end[i] < 0)
+                {
+                        end = i + 1;
+                        visit_bb_in_traversal_order(bb_in_solution_order[wto[i]], &change_at_in, &change_at_out);
+                        wto_visit_count++;
+                }
+                else if (is_single_entry_wto_component(i))
+                {
+                        end = wto_component_end[i];
+                        solve_single_entry_wto_component(i);
+                        summarised++;
+                }
+                else
+                {
+                        end = wto_component_end[i];
+                        for (position = i; position < end; position++)
+                                add_bb_to_worklist(bb_in_solution_order[wto[position]]);
+                        solve_wto_component(i);
+                        iterated++;
+                }
+        }
+
+	print_final_dfi("Basic Block Visits", wto_visit_count);
+        if (flag_gdfa_details)
+                fprintf(dump_file, "\n Components summarised = %d, Components iterated = %d *******\n", 
+                        summarised, iterated);
+
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+        {
+                free_function(&transfer_function[position]);
+                free_function(&path_function[position]);
+                free_function(&closure_function[position]);
+        }
+        XDELETEVEC(transfer_function);
+        XDELETEVEC(path_function);
+        XDELETEVEC(closure_function);
+        XDELETEVEC(wto_index_of_position);
+        transfer_function = path_function = closure_function = NULL;
+        wto_index_of_position = NULL;
+        free_dfvalue_space(value_zeros);
+        free_dfvalue_space(value_ones);
+        value_zeros = value_ones = NULL;
+        sbitmap_free(bbs_in_worklist);
+        bbs_in_worklist = NULL;
+        free_wto();
+}
+
+/* Elimination solution of separable specs with the default gen-kill
+   flows. Every bit position is independent, so with (GEN, KILL) node
+   flows the value X(b) at the confluence side of basic block b
+   satisfies, for INTERSECTION,
+
+        X(b) = K(b) * PRODUCT_j (X(j) + ~M(b,j))
+
+   and dually for UNION
+
+        X(b) = K(b) + SUM_j (X(j) * M(b,j))
+
+   where j ranges over the basic blocks that b receives values from,
+   K(b) is the boundary or top value met with the bits killed
+   (INTERSECTION) or generated (UNION) by the node flows of the sources,
+   and the mask M(b,j) holds the bits that the node flow of j passes
+   through. A term X(b) on the right hand side of its own equation is
+   dropped since the solution sought is the greatest (INTERSECTION) or
+   least (UNION) one.
+
+   The equations are numbered in the solution order and reduced by
+   Gaussian elimination: the terms X(j) with j < b are replaced by the
+   (already reduced) equation of j, the least such j first, which only
+   introduces terms with larger numbers. Replacing X(j) in a term with
+   mask M changes K(b) by K(j) + ~M (INTERSECTION) or K(j) * M (UNION)
+   and adds the terms of j with their masks intersected with M; terms
+   of the same variable are merged by the union of their masks. After
+   this, the equation of b only has terms X(j) with j > b and the values
+   are found by substituting backwards from the last equation. The
+   amount of work depends only on the CFG and not on how fast the
+   analysis converges; irreducible CFGs need no special treatment. 
+*/
+typedef struct elimination_term
+{
+        int variable;
+        dfvalue mask;
+} elimination_term;
+
+typedef struct elimination_equation
+{
+        dfvalue constant;
+        elimination_term * terms;
+        int term_count;
+        int term_space;
+} elimination_equation;
+
+static elimination_equation * equation = NULL;
+static int substitution_count = 0;
+
+/* Add the term X(variable) with mask to the equation, keeping the
+   terms sorted by variable. The mask is owned by the equation after
+   this. */
+static void
+add_term_to_equation(elimination_equation *eq, int variable, dfvalue mask)
+{
+        int low = 0, high = eq->term_count, middle;
+        dfvalue merged;
+
+        while (low < high)
+        {
+                middle = (low + high) / 2;
+                if (eq->terms[middle].variable < variable)
+                        low = middle + 1;
+                else
+                        high = middle;
+        }
+
+        if (low < eq->term_count && eq->terms[low].variable == variable)
+        {
+                merged = union_dfvalues(eq->terms[low].mask, mask);
+                free_dfvalue_space(eq->terms[low].mask);
+                free_dfvalue_space(mask);
+                eq->terms[low].mask = merged;
+                return;
+        }
+
+        if (eq->term_count == eq->term_space)
+        {
+                eq->term_space = 2 * eq->term_space + 4;
+                eq->terms = XRESIZEVEC(elimination_term, eq->terms, eq->term_space);
+        }
+        memmove(eq->terms + low + 1, eq->terms + low, 
+                (eq->term_count - low) * sizeof(elimination_term));
+        eq->terms[low].variable = variable;
+        eq->terms[low].mask = mask;
+        eq->term_count++;
+}
+
+static void
+remove_first_term_of_equation(elimination_equation *eq)
+{
+        eq->term_count--;
+        memmove(eq->terms, eq->terms + 1, eq->term_count * sizeof(elimination_term));
+}
+
+static void
+build_equation(int position)
+{
+        basic_block bb = bb_in_solution_order[position];
+        elimination_equation *eq = &equation[position];
+        gen_kill_function *f;
+        dfvalue temp, mask;
+        edge_iterator ei;
+        int source;
+        bool has_sources;
+
+        has_sources = (traversal_order == FORWARD) ? (bb->preds != NULL) : (bb->succs != NULL);
+        if (has_sources)
+                eq->constant = copy_dfvalue(value_top);
+        else
+                eq->constant = copy_dfvalue(traversal_order == FORWARD ? entry_info : exit_info);
+
+        for (ei = source_edges_of_bb(bb); !ei_end_p(ei); ei_next(&ei))
+        {
+                source = solution_position_of_bb(source_of_edge(ei_edge(ei)));
+                if (source < 0)
+                        continue;
+
+                f = &transfer_function[source];
+                if (confluence == INTERSECTION)
+                        temp = a_plus_b_minus_c(value_zeros, eq->constant, f->kill);
+                else
+                        temp = union_dfvalues(eq->constant, f->gen);
+                free_dfvalue_space(eq->constant);
+                eq->constant = temp;
+
+                temp = union_dfvalues(f->gen, f->kill);
+                mask = a_plus_b_minus_c(value_zeros, value_ones, temp);
+                free_dfvalue_space(temp);
+                add_term_to_equation(eq, source, mask);
+        }
+}
+
+/* Replace the first term X(j) of the equation of position by the
+   equation of j. */
+static void
+substitute_first_term(int position)
+{
+        elimination_equation *eq = &equation[position];
+        elimination_equation *eq_j = &equation[eq->terms[0].variable];
+        dfvalue mask = eq->terms[0].mask;
+        dfvalue temp, constant;
+        int k;
+
+        remove_first_term_of_equation(eq);
+        substitution_count++;
+
+        if (confluence == INTERSECTION)
+        {
+                temp = a_plus_b_minus_c(eq_j->constant, value_ones, mask);
+                constant = intersect_dfvalues(eq->constant, temp);
+        }
+        else
+        {
+                temp = intersect_dfvalues(eq_j->constant, mask);
+                constant = union_dfvalues(eq->constant, temp);
+        }
+        free_dfvalue_space(temp);
+        free_dfvalue_space(eq->constant);
+        eq->constant = constant;
+
+        for (k = 0; k < eq_j->term_count; k++)
+                add_term_to_equation(eq, eq_j->terms[k].variable, 
+                                     intersect_dfvalues(eq_j->terms[k].mask, mask));
+
+        free_dfvalue_space(mask);
+}
+
+static void 
+perform_elimination_pfbvdfa(void)
+{
+        int position, k;
+        elimination_equation *eq;
+        dfvalue *value, temp, term;
+        basic_block bb;
+
+        if (!is_closed_form_solution_possible())
+        {
+                if (flag_gdfa_details)
+                        fprintf(dump_file, "\n Elimination is not possible, using the weak topological order\n");
+                perform_wto_pfbvdfa();
+                return;
+        }
+ 
+	print_initial_dfi(); 
+
+        value_zeros = make_initialised_dfvalue(ZEROS);
+        value_ones = make_initialised_dfvalue(ONES);
+        transfer_function = XCNEWVEC(gen_kill_function, bbs_to_be_solved_count);
+        equation = XCNEWVEC(elimination_equation, bbs_to_be_solved_count);
+        value = XCNEWVEC(dfvalue, bbs_to_be_solved_count);
+        substitution_count = 0;
+
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+                transfer_function[position] = make_transfer_function_of_bb(bb_in_solution_order[position]);
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+                build_equation(position);
+
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+        {
+                eq = &equation[position];
+                while (eq->term_count > 0 && eq->terms[0].variable < position)
+                        substitute_first_term(position);
+                if (eq->term_count > 0 && eq->terms[0].variable == position)
+                {
+                        free_dfvalue_space(eq->terms[0].mask);
+                        remove_first_term_of_equation(eq);
+                }
+        }
+
+        for (position = bbs_to_be_solved_count - 1; position >= 0; position--)
+        {
+                eq = &equation[position];
+                value[position] = copy_dfvalue(eq->constant);
+                for (k = 0; k < eq->term_count; k++)
+                {
+                        if (confluence == INTERSECTION)
+                        {
+                                term = a_plus_b_minus_c(value[eq->terms[k].variable], value_ones, eq->terms[k].mask);
+                                temp = intersect_dfvalues(value[position], term);
+                        }
+                        else
+                        {
+                                term = intersect_dfvalues(value[eq->terms[k].variable], eq->terms[k].mask);
+                                temp = union_dfvalues(value[position], term);
+                        }
+                        free_dfvalue_space(term);
+                        free_dfvalue_space(value[position]);
+                        value[position] = temp;
+                }
+        }
+
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+        {
+                bb = bb_in_solution_order[position];
+                copy_dfvalue_into(*confluence_side_of_bb(bb), value[position]);
+                temp = apply_function(transfer_function[position], value[position]);
+                copy_dfvalue_into(*node_flow_side_of_bb(bb), temp);
+                free_dfvalue_space(temp);
+                free_dfvalue_space(value[position]);
+        }
+
+	print_final_dfi("Basic Block Visits", bbs_to_be_solved_count);
+        if (flag_gdfa_details)
+                fprintf(dump_file, "\n Substitutions = %d *******\n", substitution_count);
+
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+        {
+                eq = &equation[position];
+                for (k = 0; k < eq->term_count; k++)
+                        free_dfvalue_space(eq->terms[k].mask);
+                if (eq->terms)
+                        XDELETEVEC(eq->terms);
+                free_dfvalue_space(eq->constant);
+                free_function(&transfer_function[position]);
+        }
+        XDELETEVEC(equation);
+        XDELETEVEC(value);
+        XDELETEVEC(transfer_function);
+        equation = NULL;
+        transfer_function = NULL;
+        free_dfvalue_space(value_zeros);
+        free_dfvalue_space(value_ones);
+        value_zeros = value_ones = NULL;
+}
+
+static void
+visit_bb_in_traversal_order(basic_block bb, bool *change_at_in, bool *change_at_out)
+{
+        if (traversal_order == FORWARD)
+        {
+                *change_at_in = compute_in_info(bb);
+                *change_at_out = compute_out_info(bb);
+        }
+        else if ((traversal_order == BACKWARD) || (traversal_order == BIDIRECTIONAL))
+        {
+                *change_at_out = compute_out_info(bb);
+                *change_at_in = compute_in_info(bb);
+        }
+        else 
+        {
+                *change_at_in = *change_at_out = false;
+                report_dfa_spec_error ("Direction can only be FORWARD, BACKWARD, or BIDIRECTIONAL (Function perform_pfbvdfa)");
+        }
+}
+
+/* Queue the basic blocks whose IN or OUT is computed from a value of bb
+   that has changed in the latest visit of bb. 
+*/
+static void
+add_dependent_bbs_to_worklist(basic_block bb, bool change_at_in, bool change_at_out)
+{
+        edge e;
+        edge_iterator ei;
+
+        if (change_at_out && forward_edge_flow != &stop_flow_along_edge)
+                FOR_EACH_EDGE(e,ei,bb->succs)
+                        add_bb_to_worklist(e->dest);
+
+        if (change_at_in && backward_edge_flow != &stop_flow_along_edge)
+                FOR_EACH_EDGE(e,ei,bb->preds)
+                        add_bb_to_worklist(e->src);
+
+        /* IN(bb) is computed before OUT(bb) in the forward direction and
+           after it otherwise. The value computed first has to be
+           recomputed if it depends on the value computed later. */
+        if (traversal_order == FORWARD)
+        {
+                if (change_at_out && backward_node_flow != &stop_flow_along_node)
+                        add_bb_to_worklist(bb);
+        }
+        else if (change_at_in && forward_node_flow != &stop_flow_along_node)
+                add_bb_to_worklist(bb);
+}
+
+/* Scratch dfvalues of the driver, allocated once for each call of
+   perform_pfbvdfa so that visiting a basic block allocates nothing.
+   The edge flows are met into scratch_meet, the node flow is computed
+   into scratch_node, and the combined value is built in scratch_result
+   and copied into IN or OUT of the block only if it differs.
+
+   For plain gen-kill specifications (see is_closed_form_solution_possible)
+   the value at the confluence side of a block is the meet of its source
+   values and the other side is GEN + (X - KILL). Both are then computed
+   by the fused kernel meet_gen_kill_dfvalues_into straight into IN and
+   OUT, with the source values gathered in meet_operands. Only plain
+   dense dfvalues have a fused kernel; the other representations
+   always take the first path.
+*/
+
+static dfvalue scratch_meet = NULL;
+static dfvalue scratch_node = NULL;
+static dfvalue scratch_result = NULL;
+static dfvalue * meet_operands = NULL;
+static int max_meet_degree = 1;
+static bool use_fused_kernel = false;
+
+static void
+create_scratch_dfvalues(void)
+{
+        basic_block bb;
+        int max_degree = 1;
+
+        scratch_meet = make_uninitialised_dfvalue();
+        scratch_node = make_uninitialised_dfvalue();
+        scratch_result = make_uninitialised_dfvalue();
+
+        use_fused_kernel = is_closed_form_solution_possible() 
+                           && scratch_result->form == DENSE_DFVALUE
+                           && !scratch_result->adaptive;
+        if (use_fused_kernel)
+        {
+                FOR_ALL_BB(bb)
+                {
+                        if ((int) EDGE_COUNT(bb->preds) > max_degree)
+                                max_degree = EDGE_COUNT(bb->preds);
+                        if ((int) EDGE_COUNT(bb->succs) > max_degree)
+                                max_degree = EDGE_COUNT(bb->succs);
+                }
+                meet_operands = XNEWVEC(dfvalue, max_degree);
+        }
+        max_meet_degree = max_degree;
+}
+
+static void
+free_scratch_dfvalues(void)
+{
+        free_dfvalue_space(scratch_meet);
+        free_dfvalue_space(scratch_node);
+        free_dfvalue_space(scratch_result);
+        scratch_meet = scratch_node = scratch_result = NULL;
+        if (meet_operands)
+                XDELETEVEC(meet_operands);
+        meet_operands = NULL;
+}
+
+/* Tiled solver. In a separable analysis with the default gen-kill
+   flows every entity is a problem of its own, so the words of the
+   dfvalues can be cut into tiles of tile_words words, each of which is
+   solved to its fixpoint before the next one is started; a tile of all
+   the basic blocks stays in the cache while it is solved. Within a tile
+   the dirty basic blocks are visited in the solution order, round
+   after round, as by the priority work list, and only the words of the
+   tile are computed (see meet_gen_kill_dfvalue_words_into).
+
+   The tiles share nothing that is written, so with GDFA_THREADS they
+   are solved by several threads at once, thread t taking the tiles t,
+   t + tile_stride, and so on. Each thread has its own dirty set, meet
+   operands and scratch dfvalue, all made before the threads start
+   since the pools are not thread safe. The tiles apply only where
+   use_fused_kernel does; the visit count reported is the sum over all
+   the tiles.
+*/
+
+typedef struct tile_solver
+{
+        unsigned int first_tile;
+        sbitmap dirty;                  /* positions in the solution order */
+        dfvalue * operands;
+        dfvalue scratch;
+        int visit_count;
+} tile_solver;
+
+static unsigned int tile_words = 0;
+static unsigned int tile_count = 0;
+static unsigned int tile_stride = 1;
+
+/* Chooses tile_words and returns true if the analysis is to be solved
+   in more than one tile. */
+
+static bool
+use_tiles(void)
+{
+        unsigned int words = value_top->size;
+        unsigned int line = 64 / sizeof (SBITMAP_ELT_TYPE);
+
+        tile_words = words;
+        if (!use_fused_kernel || (GDFA_TILE_BYTES == 0 && GDFA_THREADS <= 1))
+                return false;
+
+        if (GDFA_TILE_BYTES > 0)
+                tile_words = GDFA_TILE_BYTES / (4 * number_of_nodes * sizeof (SBITMAP_ELT_TYPE));
+        if (GDFA_THREADS > 1)
+                tile_words = MIN (tile_words, (words + GDFA_THREADS - 1) / GDFA_THREADS);
+
+        /* Whole cache lines, so that no two tiles write to the same line */
+        tile_words -= tile_words % line;
+        if (tile_words < line)
+                tile_words = line;
+        return tile_words < words;
+}
+
+static void
+mark_dependent_bbs_in_tile(tile_solver * tile, basic_block bb)
+{
+        VEC(edge,gc) * targets = (traversal_order == FORWARD) ? bb->succs : bb->preds;
+        edge e;
+        edge_iterator ei;
+        int index;
+
+        FOR_EACH_EDGE(e,ei,targets)
+        {
+                index = find_index_bb((traversal_order == FORWARD) ? e->dest : e->src);
+                if (TEST_BIT(bbs_to_be_solved, index))
+                        SET_BIT(tile->dirty, solution_order_of_bb[index]);
+        }
+}
+
+/* Computes the words [first, last) of IN and OUT of bb as compute_in_info
+   and compute_out_info do with the fused kernel, and as they do without
+   it at the basic blocks without predecessors or successors, where the
+   boundary value is met in. Returns true if the value that flows out of
+   bb has changed. */
+
+static bool
+visit_bb_in_tile(tile_solver * tile, basic_block bb, unsigned int first, unsigned int last)
+{
+        bool forward = (traversal_order == FORWARD);
+        VEC(edge,gc) * sources = forward ? bb->preds : bb->succs;
+        VEC(edge,gc) * targets = forward ? bb->succs : bb->preds;
+        dfvalue * confluence_side = forward ? &CURRENT_IN(bb) : &CURRENT_OUT(bb);
+        dfvalue * node_flow_side = forward ? &CURRENT_OUT(bb) : &CURRENT_IN(bb);
+        dfvalue source_boundary = forward ? entry_info : exit_info;
+        dfvalue target_boundary = forward ? exit_info : entry_info;
+        edge e;
+        edge_iterator ei;
+        int count = 0;
+
+        if (EDGE_COUNT(sources) > 0)
+                FOR_EACH_EDGE(e,ei,sources)
+                        tile->operands[count++] = forward ? CURRENT_OUT(e->src) : CURRENT_IN(e->dest);
+        else
+                tile->operands[count++] = sources ? value_top : source_boundary;
+        meet_gen_kill_dfvalue_words_into(*confluence_side, tile->operands, count, 
+                                         confluence, NULL, NULL, first, last);
+
+        if (EDGE_COUNT(targets) > 0)
+                return meet_gen_kill_dfvalue_words_into(*node_flow_side, confluence_side, 1, 
+                                                        confluence, CURRENT_GEN(bb), CURRENT_KILL(bb), 
+                                                        first, last);
+
+        meet_gen_kill_dfvalue_words_into(tile->scratch, confluence_side, 1, 
+                                         confluence, CURRENT_GEN(bb), CURRENT_KILL(bb), 
+                                         first, last);
+        tile->operands[0] = tile->scratch;
+        tile->operands[1] = targets ? value_top : target_boundary;
+        return meet_gen_kill_dfvalue_words_into(*node_flow_side, tile->operands, 2, 
+                                                confluence, NULL, NULL, first, last);
+}
+
+static void
+solve_tile(tile_solver * tile, unsigned int tile_index)
+{
+        unsigned int first = tile_index * tile_words;
+        unsigned int last = MIN (first + tile_words, value_top->size);
+        int position;
+        basic_block bb;
+
+        sbitmap_zero(tile->dirty);
+        for (position = 0; position < bbs_to_be_solved_count; position++)
+                SET_BIT(tile->dirty, position);
+
+        while (!sbitmap_empty_p(tile->dirty))
+                for (position = 0; position < bbs_to_be_solved_count; position++)
+                {
+                        if (!TEST_BIT(tile->dirty, position))
+                                continue;
+                        RESET_BIT(tile->dirty, position);
+                        bb = bb_in_solution_order[position];
+                        tile->visit_count++;
+                        if (visit_bb_in_tile(tile, bb, first, last))
+                                mark_dependent_bbs_in_tile(tile, bb);
+                }
+}
+
+static void *
+solve_tiles(void * data)
+{
+        tile_solver * tile = (tile_solver *) data;
+        unsigned int tile_index;
+
+        for (tile_index = tile->first_tile; tile_index < tile_count; tile_index += tile_stride)
+                solve_tile(tile, tile_index);
+        return NULL;
+}
+
+static void
+perform_tiled_pfbvdfa(void)
+{
+        tile_solver tiles[GDFA_THREADS];
+#if GDFA_THREADS > 1
+        pthread_t threads[GDFA_THREADS];
+        bool started[GDFA_THREADS];
+#endif
+        unsigned int t;
+        int visit_count = 0;
+
+	print_initial_dfi(); 
+
+        tile_count = (value_top->size + tile_words - 1) / tile_words;
+        tile_stride = MIN (GDFA_THREADS, tile_count);
+        for (t = 0; t < tile_stride; t++)
+        {
+                tiles[t].first_tile = t;
+                tiles[t].dirty = sbitmap_alloc(number_of_nodes);
+                tiles[t].operands = XNEWVEC(dfvalue, MAX (max_meet_degree, 2));
+                tiles[t].scratch = make_uninitialised_dfvalue();
+                tiles[t].visit_count = 0;
+        }
+
+#if GDFA_THREADS > 1
+        for (t = 1; t < tile_stride; t++)
+                started[t] = (pthread_create(&threads[t], NULL, solve_tiles, &tiles[t]) == 0);
+#endif
+        solve_tiles(&tiles[0]);
+#if GDFA_THREADS > 1
+        /* The tiles of a thread that could not be started are solved here */
+        for (t = 1; t < tile_stride; t++)
+                if (started[t])
+                        pthread_join(threads[t], NULL);
+                else
+                        solve_tiles(&tiles[t]);
+#endif
+
+        for (t = 0; t < tile_stride; t++)
+        {
+                visit_count += tiles[t].visit_count;
+                sbitmap_free(tiles[t].dirty);
+                XDELETEVEC(tiles[t].operands);
+                free_dfvalue_space(tiles[t].scratch);
+        }
+
+	print_final_dfi("Basic Block Visits", visit_count);
+        if (flag_gdfa_details)
+                fprintf(dump_file, "\n Tiles = %u of %u words, Threads = %u *******\n", 
+                        tile_count, tile_words, tile_stride);
+}
+
+static bool 
+compute_in_info(basic_block bb)
+{        
+        bool change;
+        edge e;
+        edge_iterator ei;
+        int count = 0;
+
+        if (use_fused_kernel && EDGE_COUNT(bb->preds) > 0)
+        {
+                if (traversal_order == BACKWARD)
+                        return meet_gen_kill_dfvalues_into(CURRENT_IN(bb), &CURRENT_OUT(bb), 1, 
+                                        confluence, CURRENT_GEN(bb), CURRENT_KILL(bb));
+                FOR_EACH_EDGE(e,ei,bb->preds)
+                        meet_operands[count++] = CURRENT_OUT(e->src);
+                return meet_gen_kill_dfvalues_into(CURRENT_IN(bb), meet_operands, count, 
+                                        confluence, NULL, NULL);
+        }
+
+        change_at_in_out_of_stmt = false;
+
+        if (!bb->preds) 
+                combine_into(scratch_result, entry_info, 
+                                     node_flow_of_bb(backward_node_flow, bb));
+        else 
+                combine_into(scratch_result, combined_forward_edge_flow(bb),
+                                     node_flow_of_bb(backward_node_flow, bb));
+
+        /*DEBUG*/
+        //if(is_nonseparable ) { 
+        //    fprintf(stdout, "in compute_in_info");  
+        //    dump_dfvalue(stdout, scratch_result);
+        //}
+                            
+        change = update_dfvalue(CURRENT_IN(bb), scratch_result);
+        return change || change_at_in_out_of_stmt ;
+}
+
+static bool 
+compute_out_info(basic_block bb)
+{        
+        bool change;
+        edge e;
+        edge_iterator ei;
+        int count = 0;
+
+        if (use_fused_kernel && EDGE_COUNT(bb->succs) > 0)
+        {
+                if (traversal_order == FORWARD)
+                        return meet_gen_kill_dfvalues_into(CURRENT_OUT(bb), &CURRENT_IN(bb), 1, 
+                                        confluence, CURRENT_GEN(bb), CURRENT_KILL(bb));
+                FOR_EACH_EDGE(e,ei,bb->succs)
+                        meet_operands[count++] = CURRENT_IN(e->dest);
+                return meet_gen_kill_dfvalues_into(CURRENT_OUT(bb), meet_operands, count, 
+                                        confluence, NULL, NULL);
+        }
+
+        change_at_in_out_of_stmt = false;
+
+        if (!bb->succs)
+                combine_into(scratch_result, exit_info, 
+                                     node_flow_of_bb(forward_node_flow, bb));
+        else
+                combine_into(scratch_result, combined_backward_edge_flow(bb),
+                                     node_flow_of_bb(forward_node_flow, bb));
+                       
+        /*DEBUG*/
+        //if(is_nonseparable ) { 
+        //    fprintf(stdout, "in compute_out_info");  
+        //    dump_dfvalue(stdout, scratch_result);
+        //}
+
+        change = update_dfvalue(CURRENT_OUT(bb), scratch_result);
+        return change || change_at_in_out_of_stmt;
+}
+
+
+/* The edge flows of bb are met into scratch_meet, which is returned.
+   Values of the default edge flows are used where they lie; those of
+   user defined edge flows are freed once they have been met in.
+*/
+
+static dfvalue
+combined_forward_edge_flow(basic_block bb)
+{                
+        dfvalue flow;
+        edge e;
+        edge_iterator ei;
+
+        initialise_dfvalue(scratch_meet, top_value_spec);
+
+        if (forward_edge_flow == &stop_flow_along_edge)
+                return scratch_meet;
+        
+        FOR_EACH_EDGE(e,ei,bb->preds)
+        {
+                flow = forward_edge_flow(e->src,bb);
+                combine_into(scratch_meet, scratch_meet, flow);
+                if (!is_borrowed_edge_flow(forward_edge_flow))
+                        free_dfvalue_space(flow);
+        }
+        return scratch_meet;
+}
+
+static dfvalue
+combined_backward_edge_flow(basic_block bb)
+{                
+        dfvalue flow;
+        edge e;
+        edge_iterator ei;
+
+        initialise_dfvalue(scratch_meet, top_value_spec);
+
+        if (backward_edge_flow == &stop_flow_along_edge)
+                return scratch_meet;
+
+        FOR_EACH_EDGE(e,ei,bb->succs)
+        {
+                flow = backward_edge_flow(bb,e->dest);
+                combine_into(scratch_meet, scratch_meet, flow);
+                if (!is_borrowed_edge_flow(backward_edge_flow))
+                        free_dfvalue_space(flow);
+        }                
+        return scratch_meet;
+}
+
+/* Returns the value of node_flow for bb without allocating. The gen-kill
+   flows are computed directly into scratch_node and the identity and
+   stop flows are used where they lie, while the value of a user defined
+   node flow is copied into scratch_node and freed.
+*/
+
+static dfvalue
+node_flow_of_bb(dfvalue (*node_flow)(basic_block), basic_block bb)
+{
+        dfvalue flow;
+
+        if (node_flow == &forward_gen_kill_node_flow)
+        {
+                forward_gen_kill_node_flow_into(scratch_node, bb);
+                return scratch_node;
+        }
+        if (node_flow == &backward_gen_kill_node_flow)
+        {
+                backward_gen_kill_node_flow_into(scratch_node, bb);
+                return scratch_node;
+        }
+
+        flow = node_flow(bb);
+        if (is_borrowed_node_flow(node_flow))
+                return flow;
+
+        copy_dfvalue_into(scratch_node, flow);
+        free_dfvalue_space(flow);
+        return scratch_node;
+}
+
+/* Releases what preserve does not keep of storage, a dfi set of count
+   nodes, and interns what it keeps. Only when the local properties are
+   dropped but the global ones kept are the GEN and KILL pointers of the
+   nodes cleared, so that the clients do not see released rows.
+*/
+
+static void
+release_dfi_storage(dfi_storage * storage, int count, dfi_to_be_preserved preserve)
+{
+        int iter;
+
+        switch (preserve)
+        {        
+                case no_value:
+                        free_dfvalue_slab(storage->gen);
+                        free_dfvalue_slab(storage->kill);
+                        free_dfvalue_slab(storage->in);
+                        free_dfvalue_slab(storage->out);
+                        free_dfvalue_slab(storage->rows);
+                        XDELETEVEC(storage->nodes);
+                        XDELETEVEC(storage->dfi);
+                        XDELETE(storage);
+                        return;
+                case global_only:
+                        for (iter=0; iter < count; iter++)
+                        {
+                                GEN_nid(storage->dfi,iter) = NULL;
+                                KILL_nid(storage->dfi,iter) = NULL;
+                        }
+                        free_dfvalue_slab(storage->gen);
+                        free_dfvalue_slab(storage->kill);
+                        storage->gen = storage->kill = NULL;
+                        break;
+                case all:
+                        break;
+                default:
+                        report_dfa_spec_error("Wrong choice of values to be preserved (Function preserve_dfi)");
+                        break;
+        }
+
+        storage->of_bbs = (storage == bb_dfi_storage);
+        intern_dfi_storage(storage);
+        encode_dfi_storage(storage, storage->of_bbs);
+        storage->next = preserved_dfi_storage;
+        preserved_dfi_storage = storage;
+}
+
+/* Preserved values are read only from now on, so the values of a
+   preserved dfi set are replaced by interned ones (see intern_dfvalue)
+   and its slabs are released. Identical values of the basic blocks or
+   statements, and of other preserved results, then share one copy.
+*/
+
+static void
+intern_dfi_storage(dfi_storage * storage)
+{
+        pfbv_dfi * node;
+        int iter;
+
+        for (iter=0; iter < storage->count; iter++)
+        {
+                node = &storage->nodes[iter];
+                if (node->gen)
+                        node->gen = intern_dfvalue(node->gen);
+                if (node->kill)
+                        node->kill = intern_dfvalue(node->kill);
+                node->in = intern_dfvalue(node->in);
+                node->out = intern_dfvalue(node->out);
+        }
+
+        free_dfvalue_slab(storage->gen);
+        free_dfvalue_slab(storage->kill);
+        free_dfvalue_slab(storage->in);
+        free_dfvalue_slab(storage->out);
+        free_dfvalue_slab(storage->rows);
+        storage->gen = storage->kill = storage->in = storage->out = storage->rows = NULL;
+}
+
+/* Keeps IN and OUT of the preserved storage in the compact form
+   described at pfbv_dfi_delta. Basic blocks are visited in the order of
+   their rows, which is the depth first order of the analysis, and
+   statements in the direction of the analysis, so that the neighbours
+   on the entry side of a node mostly come before it.
+*/
+
+static void
+encode_dfi_storage(dfi_storage * storage, bool of_bbs)
+{
+        bool forward = (traversal_order != BACKWARD);
+        int * depth, * nid_of_row;
+        int iter, row, neighbour;
+        pfbv_dfi * node;
+        basic_block bb;
+        edge_iterator ei;
+        edge e;
+
+        depth = XNEWVEC(int, 2 * MAX(storage->count,1));
+        nid_of_row = XNEWVEC(int, MAX(storage->count,1));
+        storage->deltas = XCNEWVEC(struct pfbv_dfi_delta, MAX(storage->count,1));
+        for (iter=0; iter < storage->count; iter++)
+        {
+                nid_of_row[DFI_nid(storage->dfi,iter) - storage->nodes] = iter;
+                depth[2 * iter] = depth[2 * iter + 1] = -1;
+        }
+
+        for (iter=0; iter < storage->count; iter++)
+        {
+                row = (of_bbs || forward) ? iter : storage->count - 1 - iter;
+                node = &storage->nodes[row];
+                bb = of_bbs ? BASIC_BLOCK(nid_of_row[row]) : NULL;
+                if (bb && forward)
+                        FOR_EACH_EDGE(e, ei, bb->preds)
+                                encode_dfi_value(storage, depth, node, false,
+                                                 DFI_nid(storage->dfi,find_index_bb(e->src)));
+                else if (bb)
+                        FOR_EACH_EDGE(e, ei, bb->succs)
+                                encode_dfi_value(storage, depth, node, true,
+                                                 DFI_nid(storage->dfi,find_index_bb(e->dest)));
+                else if (!of_bbs)
+                {
+                        neighbour = nid_of_row[row] + (forward ? -1 : 1);
+                        if (neighbour >= 0 && neighbour < storage->count)
+                                encode_dfi_value(storage, depth, node, !forward,
+                                                 DFI_nid(storage->dfi,neighbour));
+                }
+                encode_dfi_value(storage, depth, node, !forward, NULL);
+                encode_dfi_value(storage, depth, node, forward, node);
+                encode_dfi_value(storage, depth, node, forward, NULL);
+        }
+
+        /* The whole values are needed as bases until every delta is made */
+        for (row=0; row < storage->count; row++)
+        {
+                node = &storage->nodes[row];
+                if (node->delta && node->delta->in)
+                {
+                        release_interned_dfvalue(node->in);
+                        node->in = NULL;
+                }
+                if (node->delta && node->delta->out)
+                {
+                        release_interned_dfvalue(node->out);
+                        node->out = NULL;
+                }
+        }
+        XDELETEVEC(depth);
+        XDELETEVEC(nid_of_row);
+}
+
+/* Keeps OUT of node, if out is true, or else its IN as a delta against
+   the value on the other side of base, if that delta is smaller than
+   the dense words and than any delta found before. The depth of a
+   value is the number of deltas to apply to decode it, and -1 until it
+   has been settled. The side is settled, with the best delta found so
+   far, when base is NULL. A base that has not been settled yet is
+   skipped, since its own delta might lead back to node.
+*/
+
+static void
+encode_dfi_value(dfi_storage * storage, int * depth, pfbv_dfi * node, 
+                 bool out, pfbv_dfi * base)
+{
+        struct pfbv_dfi_delta * delta;
+        dfvalue_delta * kept, candidate;
+        pfbv_dfi ** kept_base;
+        int side, base_side;
+        unsigned int limit;
+        dfvalue value;
+
+        delta = &storage->deltas[node - storage->nodes];
+        kept = out ? &delta->out : &delta->in;
+        kept_base = out ? &delta->out_base : &delta->in_base;
+        side = 2 * (node - storage->nodes) + out;
+        value = out ? node->out : node->in;
+
+        if (depth[side] >= 0)
+                return;
+        if (base == NULL)
+        {
+                depth[side] = *kept ? depth[2 * (*kept_base - storage->nodes) + !out] + 1 : 0;
+                if (*kept)
+                        node->delta = delta;
+                return;
+        }
+
+        base_side = 2 * (base - storage->nodes) + !out;
+        if (depth[base_side] < 0 || depth[base_side] >= DFI_DELTA_MAX_CHAIN)
+                return;
+
+        limit = value->size * sizeof (SBITMAP_ELT_TYPE) / sizeof (unsigned int);
+        if (*kept)
+                limit = MIN(limit, dfvalue_delta_size(*kept));
+        if (limit == 0)
+                return;
+        candidate = make_dfvalue_delta(value, out ? base->in : base->out, limit - 1);
+        if (!candidate)
+                return;
+        if (*kept)
+                free_dfvalue_delta(*kept);
+        *kept = candidate;
+        *kept_base = base;
+}
+
+/* IN of node, or its OUT if out is true, decoded into dest by applying
+   the chain of deltas leading to it from a whole value in reverse. dest
+   is replaced by a new value if it is NULL or of another universe. */
+
+static dfvalue
+decode_dfvalue(dfvalue dest, pfbv_dfi * node, bool out)
+{
+        pfbv_dfi * chain[DFI_DELTA_MAX_CHAIN + 1];
+        bool chain_out[DFI_DELTA_MAX_CHAIN + 1];
+        dfvalue base;
+        int length = 0;
+
+        while (!(base = out ? node->out : node->in))
+        {
+                chain[length] = node;
+                chain_out[length++] = out;
+                node = out ? node->delta->out_base : node->delta->in_base;
+                out = !out;
+        }
+
+        if (dest && dest->n_bits != base->n_bits)
+        {
+                free_dfvalue_space(dest);
+                dest = NULL;
+        }
+        if (!dest)
+                dest = make_unpooled_dfvalue(DENSE_DFVALUE, base->n_bits);
+        copy_dfvalue_into(dest, base);
+        while (length--)
+                apply_dfvalue_delta(dest, chain_out[length] ? chain[length]->delta->out 
+                                                            : chain[length]->delta->in);
+        return dest;
+}
+
+/* IN of node, or its OUT if out is true. A value kept as a delta is
+   decoded into the cache of decoded values, unless it is there already,
+   and its entry becomes the most recently used one. The value stays
+   valid until the entry is reused, that is at least until the next
+   DECODED_DFVALUE_CACHE_SIZE - 1 values kept as deltas are decoded, and
+   never beyond release_preserved_dfi; a client that keeps it longer
+   copies it (see copy_decoded_dfvalue_into). */
+
+dfvalue
+decoded_dfvalue(pfbv_dfi * node, bool out)
+{
+        dfvalue value = out ? node->out : node->in;
+        struct decoded_dfvalue_entry * entry;
+        int iter;
+
+        if (!node->delta)
+                return value;
+        if (node->delta->replay)
+                return read_replayed_dfvalue(node->delta->replay, node, out ? 3 : 2);
+        if (value)
+                return value;
+
+        decoded_dfvalue_uses++;
+        for (iter=0; iter < DECODED_DFVALUE_CACHE_SIZE; iter++)
+                if (decoded_dfvalues[iter].node == node && decoded_dfvalues[iter].out == out)
+                {
+                        decoded_dfvalues[iter].last_use = decoded_dfvalue_uses;
+                        return decoded_dfvalues[iter].value;
+                }
+
+        entry = &decoded_dfvalues[0];
+        for (iter=1; iter < DECODED_DFVALUE_CACHE_SIZE && entry->node; iter++)
+                if (!decoded_dfvalues[iter].node || decoded_dfvalues[iter].last_use < entry->last_use)
+                        entry = &decoded_dfvalues[iter];
+        entry->node = node;
+        entry->out = out;
+        entry->last_use = decoded_dfvalue_uses;
+        entry->value = decode_dfvalue(entry->value, node, out);
+        return entry->value;
+}
+
+/* Copies IN of node, or its OUT if out is true, into dest, a value of
+   the universe of the analysis, for a client that keeps the value
+   longer than the value read through the IN and OUT macros stays valid.
+   Returns false, leaving dest alone, if the value is not kept. */
+
+bool
+copy_decoded_dfvalue_into(dfvalue dest, pfbv_dfi * node, bool out)
+{
+        dfvalue value = decoded_dfvalue(node, out);
+
+        if (!value)
+                return false;
+        copy_dfvalue_into(dest, value);
+        return true;
+}
+
+/* Transposed index of a preserved dfi set of basic blocks: for each
+   entity, the set of positions of the basic blocks at which it is in
+   IN, or in OUT. The positions follow the reverse postorder of the CFG
+   and then the basic blocks it does not reach, as the rows of a forward
+   analysis do, so the basic blocks of an entity tend to come in runs.
+   A client that acts on one entity at a time visits only the basic
+   blocks in its result instead of testing the dfvalue of every basic
+   block. An index is built on the first request for a dfi set and side
+   and is released with the dfi set by release_preserved_dfi.
+*/
+
+struct dfi_entity_index_def
+{
+        pfbv_dfi ** dfi;
+        bool out;
+        int entity_count;
+        int position_count;
+        bitmap * positions;                 /* of each entity */
+        basic_block * bb_at;                /* of each position */
+        bitmap_obstack obstack;
+        struct dfi_entity_index_def * next;
+};
+
+static dfi_entity_index entity_indexes = NULL;
+
+dfi_entity_index
+index_dfi_by_entity(pfbv_dfi ** dfi, bool out)
+{
+        dfi_entity_index index;
+        dfi_storage * storage;
+        dfvalue value;
+        int * row_of_bb;
+        int * node_at;
+        int position, nid, entity;
+
+        for (index = entity_indexes; index; index = index->next)
+                if (index->dfi == dfi && index->out == out)
+                        return index;
+
+        for (storage = preserved_dfi_storage; storage; storage = storage->next)
+                if (storage->dfi == dfi)
+                        break;
+        if (!storage || !storage->of_bbs || storage->count == 0)
+        {
+                report_dfa_spec_error ("Only the preserved data flow information of basic blocks can be indexed (Function index_dfi_by_entity)");
+                return NULL;
+        }
+
+        index = XCNEW(struct dfi_entity_index_def);
+        index->dfi = dfi;
+        index->out = out;
+        /* The values are decoded into one scratch value, so that indexing
+           does not keep every value decoded */
+        value = decode_dfvalue(NULL, dfi[0], out);
+        index->entity_count = value->n_bits;
+        index->position_count = storage->count;
+        bitmap_obstack_initialize(&index->obstack);
+        index->positions = XNEWVEC(bitmap, index->entity_count);
+        for (entity = 0; entity < index->entity_count; entity++)
+                index->positions[entity] = BITMAP_ALLOC(&index->obstack);
+
+        ensure_cfg_orders();
+        row_of_bb = row_order_of_bbs(FORWARD);
+        node_at = XNEWVEC(int, storage->count);
+        index->bb_at = XNEWVEC(basic_block, storage->count);
+        for (nid = 0; nid < storage->count; nid++)
+        {
+                node_at[row_of_bb[nid]] = nid;
+                index->bb_at[row_of_bb[nid]] = BASIC_BLOCK(nid);
+        }
+
+        /* The positions are added to the bitmaps in increasing order */
+        for (position = 0; position < storage->count; position++)
+        {
+                decode_dfvalue(value, dfi[node_at[position]], out);
+                for (entity = next_dfvalue_member(value, 0); entity >= 0; 
+                     entity = next_dfvalue_member(value, entity + 1))
+                        bitmap_set_bit(index->positions[entity], position);
+        }
+        free_dfvalue_space(value);
+        XDELETEVEC(node_at);
+        XDELETEVEC(row_of_bb);
+
+        index->next = entity_indexes;
+        entity_indexes = index;
+        return index;
+}
+
+/* The positions of the basic blocks at which entity is in the indexed
+   side, to be walked with EXECUTE_IF_SET_IN_BITMAP and mapped to basic
+   blocks by bb_at_index_position. */
+
+bitmap
+bbs_of_entity(dfi_entity_index index, int entity)
+{
+        if (entity < 0 || entity >= index->entity_count)
+        {
+                report_dfa_spec_error ("Entity out of the universe of the index (Function bbs_of_entity)");
+                return NULL;
+        }
+        return index->positions[entity];
+}
+
+basic_block
+bb_at_index_position(dfi_entity_index index, int position)
+{
+        if (position < 0 || position >= index->position_count)
+        {
+                report_dfa_spec_error ("Position out of the index (Function bb_at_index_position)");
+                return NULL;
+        }
+        return index->bb_at[position];
+}
+
+#if CHECK_GDFA_ENTITY_INDEX
+/* Checks the indices of both sides of dfi against IN and OUT of every
+   basic block, as a client walking the basic blocks of an entity would
+   read them. */
+
+static void
+verify_dfi_entity_index(pfbv_dfi ** dfi)
+{
+        dfi_entity_index index;
+        basic_block bb;
+        dfvalue value;
+        int side, position, entity;
+
+        for (side = 0; side < 2; side++)
+        {
+                index = index_dfi_by_entity(dfi, side != 0);
+                for (position = 0; position < index->position_count; position++)
+                {
+                        bb = bb_at_index_position(index, position);
+                        value = decoded_dfvalue(dfi[find_index_bb(bb)], side != 0);
+                        for (entity = 0; entity < index->entity_count; entity++)
+                                if (dfvalue_bit_p(value, entity)
+                                    != (bitmap_bit_p(bbs_of_entity(index, entity), position) != 0))
+                                        report_dfa_spec_error ("The basic blocks of an entity differ from IN or OUT (Function verify_dfi_entity_index)");
+                }
+        }
+}
+#endif
+
+void
+release_preserved_dfi(void)
+{
+        dfi_storage * storage;
+        dfi_entity_index index;
+
+        pfbv_dfi * node;
+        int iter;
+
+        while ((index = entity_indexes))
+        {
+                entity_indexes = index->next;
+                bitmap_obstack_release(&index->obstack);
+                XDELETEVEC(index->positions);
+                XDELETEVEC(index->bb_at);
+                XDELETE(index);
+        }
+
+        for (iter=0; iter < DECODED_DFVALUE_CACHE_SIZE; iter++)
+        {
+                if (decoded_dfvalues[iter].value)
+                        free_dfvalue_space(decoded_dfvalues[iter].value);
+                decoded_dfvalues[iter].value = NULL;
+                decoded_dfvalues[iter].node = NULL;
+        }
+
+        while ((storage = preserved_dfi_storage))
+        {
+                preserved_dfi_storage = storage->next;
+                if (storage->replay)
+                        free_stmt_replay(storage->replay);
+                for (iter=0; iter < storage->count && !storage->replay; iter++)
+                {
+                        node = &storage->nodes[iter];
+                        if (node->gen)
+                                release_interned_dfvalue(node->gen);
+                        if (node->kill)
+                                release_interned_dfvalue(node->kill);
+                        if (node->in)
+                                release_interned_dfvalue(node->in);
+                        if (node->out)
+                                release_interned_dfvalue(node->out);
+                        if (storage->deltas[iter].in)
+                                free_dfvalue_delta(storage->deltas[iter].in);
+                        if (storage->deltas[iter].out)
+                                free_dfvalue_delta(storage->deltas[iter].out);
+                }
+                XDELETEVEC(storage->deltas);
+                XDELETEVEC(storage->nodes);
+                XDELETEVEC(storage->dfi);
+                XDELETE(storage);
+        }
+}
+
+static void
+preserve_dfi(dfi_to_be_preserved preserve)
+{
+        release_dfi_storage(bb_dfi_storage, number_of_nodes, preserve);
+        bb_dfi_storage = NULL;
+        if (preserve == no_value)
+                current_pfbv_dfi = NULL;
+
+        if(is_nonseparable && stmt_dfi_storage != NULL) 
+        {
+                if (stmt_replay)
+                        preserve_replayed_dfi(preserve);
+                else
+                        release_dfi_storage(stmt_dfi_storage, local_stmt_count, preserve);
+                stmt_dfi_storage = NULL;
+                if (preserve == no_value)
+                        current_pfbv_dfi_of_stmt = NULL;
+        }
+}
+
+/* The row of every basic block in the slabs of a dfi set: the basic
+   blocks in the order of the depth first traversal of the CFG for
+   forward analyses and of the reverse CFG otherwise, followed by the
+   basic blocks that the traversal does not reach.
+*/
+
+static int *
+row_order_of_bbs(traversal_direction direction)
+{
+        varray_type order;
+        int * row_of_bb;
+        int position, nid, rows = 0;
+        basic_block bb;
+
+        order = (direction == FORWARD) ? dfs_ordered_basic_blocks 
+                                       : reverse_dfs_ordered_basic_blocks;
+        row_of_bb = XNEWVEC(int, number_of_nodes);
+
+        for (nid = 0; nid < number_of_nodes; nid++)
+                row_of_bb[nid] = -1;
+        for (position = 0; position < number_of_nodes; position++)
+                if ((bb = VARRAY_BB(order, position)))
+                        row_of_bb[find_index_bb(bb)] = rows++;
+        for (nid = 0; nid < number_of_nodes; nid++)
+                if (row_of_bb[nid] < 0)
+                        row_of_bb[nid] = rows++;
+        return row_of_bb;
+}
+
+/* Creates a dfi set of count nodes. Node nid is placed in row
+   row_of_node[nid], or in row nid if row_of_node is NULL. IN and OUT
+   start as top and the local properties as empty sets.
+*/
+
+static dfi_storage *
+create_dfi_space(int count, const int * row_of_node)
+{
+        dfi_storage * storage;
+        int iter, row;
+
+        storage = XCNEW(dfi_storage);
+        storage->count = count;
+        storage->dfi = XCNEWVEC(pfbv_dfi *, MAX(count,1));
+        storage->nodes = XCNEWVEC(pfbv_dfi, MAX(count,1));
+        if (SBITMAP_SET_SIZE(relevant_pfbv_entity_count) <= DFVALUE_SMALL_WORDS)
+                storage->rows = make_dfvalue_slab(4 * count, ZEROS);
+        else
+        {
+                storage->gen = make_dfvalue_slab(count, ZEROS);
+                storage->kill = make_dfvalue_slab(count, ZEROS);
+                storage->in = make_dfvalue_slab(count, top_value_spec);
+                storage->out = make_dfvalue_slab(count, top_value_spec);
+        }
+
+        for (iter=0; iter < count; iter++)
+        {         
+
+                /* We use nid to access DFI because for nid 0 and 1, bb is NULL */
+
+                row = row_of_node ? row_of_node[iter] : iter;
+                DFI_nid(storage->dfi,iter) = &storage->nodes[row];
+
+                if (storage->rows)
+                {
+                        GEN_nid(storage->dfi,iter) = dfvalue_of_slab(storage->rows, 4 * row);
+                        KILL_nid(storage->dfi,iter) = dfvalue_of_slab(storage->rows, 4 * row + 1);
+                        DFI_nid(storage->dfi,iter)->in = dfvalue_of_slab(storage->rows, 4 * row + 2);
+                        DFI_nid(storage->dfi,iter)->out = dfvalue_of_slab(storage->rows, 4 * row + 3);
+                        initialise_dfvalue(DFI_nid(storage->dfi,iter)->in, top_value_spec);
+                        initialise_dfvalue(DFI_nid(storage->dfi,iter)->out, top_value_spec);
+                        continue;
+                }
+
+                GEN_nid(storage->dfi,iter) = dfvalue_of_slab(storage->gen, row);
+                KILL_nid(storage->dfi,iter) = dfvalue_of_slab(storage->kill, row);
+                DFI_nid(storage->dfi,iter)->in = dfvalue_of_slab(storage->in, row);
+                DFI_nid(storage->dfi,iter)->out = dfvalue_of_slab(storage->out, row);
+        }
+        return storage;
+}
+
+
+/********** Default node and edge flow functions   *************/
+
+dfvalue
+identity_forward_edge_flow(basic_block src, basic_block dest)
+{
+        return CURRENT_OUT(src);
 }
 
 dfvalue
 identity_backward_edge_flow(basic_block src, basic_block dest)
 {
-        return CURRENT_IN(dest);
+        return CURRENT_IN(dest);
+}
+
+dfvalue
+identity_forward_node_flow(basic_block bb)
+{
+        return CURRENT_IN(bb);
+}
+
+dfvalue
+identity_backward_node_flow(basic_block bb)
+{
+        return CURRENT_OUT(bb);
+}
+
+dfvalue
+stop_flow_along_node(basic_block bb)
+{
+        return value_top;
+}
+
+dfvalue
+stop_flow_along_edge(basic_block src, basic_block dest)
+{
+        return value_top;
+}
+
+/* The gen-kill flows return a newly allocated dfvalue so that user
+   defined flow functions may build on them; the driver itself uses the
+   _into variants which write into a dfvalue it owns. For non-separable
+   analyses the values at statements are kept in their own storage and
+   are updated in place.
+*/
+
+dfvalue
+forward_gen_kill_node_flow(basic_block bb)
+{
+        dfvalue temp;
+
+        temp = make_uninitialised_dfvalue();
+        forward_gen_kill_node_flow_into(temp, bb);
+        return temp;
+}
+
+dfvalue
+backward_gen_kill_node_flow(basic_block bb)
+{
+        dfvalue temp;
+
+        temp = make_uninitialised_dfvalue();
+        backward_gen_kill_node_flow_into(temp, bb);
+        return temp;
+}
+
+static void
+forward_gen_kill_node_flow_into(dfvalue result, basic_block bb)
+{
+        int nid, position, iter;
+        bool change_at_in, change_at_out;
+
+        if(true == is_nonseparable) 
+        {
+                nid = find_index_bb(bb);
+                if (stmt_replay)
+                {
+                        evaluate_stmts_at_boundaries(result, CURRENT_IN(bb), nid, true);
+                        return;
+                }
+                if (TEST_BIT(replayed_bbs, nid))
+                {
+                        replay_stmts_of_bb(result, CURRENT_IN(bb), nid, true);
+                        return;
+                }
+                SET_BIT(replayed_bbs, nid);
+
+                copy_dfvalue_into(result, CURRENT_IN(bb));
+                for (position = first_stmt_of_bb[nid]; position < first_stmt_of_bb[nid + 1]; position++)
+                {
+                        iter = stmts_of_bbs[position];
+
+                        change_at_in = update_dfvalue(IN_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter), result);
+                        apply_stmt_transfers(result, iter);
+                        change_at_out = update_dfvalue(OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter), result);
+
+                        change_at_in_out_of_stmt = change_at_in_out_of_stmt || change_at_out || change_at_in;
+                }
+        } else {
+	        a_plus_b_minus_c_into(result, CURRENT_GEN(bb), CURRENT_IN(bb), CURRENT_KILL(bb));
+        }
+}
+
+static void
+backward_gen_kill_node_flow_into(dfvalue result, basic_block bb)
+{
+        int nid, position, iter;
+        bool change_at_in, change_at_out;
+
+        if(true == is_nonseparable) 
+        {
+                nid = find_index_bb(bb);
+                if (stmt_replay)
+                {
+                        evaluate_stmts_at_boundaries(result, CURRENT_OUT(bb), nid, false);
+                        return;
+                }
+                if (TEST_BIT(replayed_bbs, nid))
+                {
+                        replay_stmts_of_bb(result, CURRENT_OUT(bb), nid, false);
+                        return;
+                }
+                SET_BIT(replayed_bbs, nid);
+
+                copy_dfvalue_into(result, CURRENT_OUT(bb));
+                for (position = first_stmt_of_bb[nid + 1] - 1; position >= first_stmt_of_bb[nid]; position--)
+                {
+                        iter = stmts_of_bbs[position];
+
+                        change_at_out = update_dfvalue(OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter), result);
+                        apply_stmt_transfers(result, iter);
+                        change_at_in = update_dfvalue(IN_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter), result);
+
+                        change_at_in_out_of_stmt = change_at_in_out_of_stmt || change_at_out || change_at_in;
+                }
+        } else {
+	        a_plus_b_minus_c_into(result, CURRENT_GEN(bb), CURRENT_OUT(bb), CURRENT_KILL(bb));
+        }
+}
+
+/* The identity and stop flows return dfvalues owned by the driver. */
+
+static bool
+is_borrowed_edge_flow(dfvalue (*edge_flow)(basic_block, basic_block))
+{
+        return (edge_flow == &identity_forward_edge_flow 
+                || edge_flow == &identity_backward_edge_flow
+                || edge_flow == &stop_flow_along_edge);
+}
+
+static bool
+is_borrowed_node_flow(dfvalue (*node_flow)(basic_block))
+{
+        return (node_flow == &identity_forward_node_flow 
+                || node_flow == &identity_backward_node_flow
+                || node_flow == &stop_flow_along_node);
+}
+
+static dfvalue
+combine (dfvalue value1, dfvalue value2)
+{        
+        dfvalue temp;
+
+
+        if (confluence == INTERSECTION)
+                temp = intersect_dfvalues(value1, value2);
+        else if (confluence == UNION)
+                temp = union_dfvalues(value1, value2);
+        else 
+                 report_dfa_spec_error ("Confluence can only be UNION or INTERSECTION (Function combine)");
+
+        return temp;
+}
+
+static void
+combine_into (dfvalue dest, dfvalue value1, dfvalue value2)
+{        
+        if (confluence == INTERSECTION)
+                intersect_dfvalues_into(dest, value1, value2);
+        else if (confluence == UNION)
+                union_dfvalues_into(dest, value1, value2);
+        else 
+                 report_dfa_spec_error ("Confluence can only be UNION or INTERSECTION (Function combine_into)");
+}
+
+
+/***************  Specification Driven Local Property Computation ***************/
+
+static void
+local_dfa_nonseparable(struct gimple_pfbv_dfa_spec dfa_spec)
+{
+        int iter;
+        tree stmt = NULL;
+        dfvalue temp;
+
+        /* The constant parts of GEN and KILL of the statements replayed
+           from the boundaries of basic blocks are compiled instead */
+        for (iter=0; iter < local_stmt_count && !stmt_replay; iter++)
+        {
+                stmt                                                 = local_stmt_list[iter];
+                if ((temp = local_dfa_of_stmt(gen_lps, stmt)))
+                {
+                        copy_dfvalue_into(GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter), temp);
+                        free_dfvalue_space(temp);
+                }
+                if ((temp = local_dfa_of_stmt(kill_lps, stmt)))
+                {
+                        copy_dfvalue_into(KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter), temp);
+                        free_dfvalue_space(temp);
+                }
+        }       
+        compile_stmt_transfers();
+}        
+
+static dfvalue 
+local_dfa_of_stmt(lp_specs_nonseparable lps_given, tree stmt)
+{
+    dfvalue dfvalue_of_stmt = NULL;
+    switch (lps_given.entity)
+        {
+        case entity_var:
+            dfvalue_of_stmt = var_in_statement_nonseparable(stmt,lps_given);
+            break;
+        case entity_expr:
+            break;
+        case entity_defn:
+            break;
+        default :
+            report_dfa_spec_error ("Wrong choice of entity in local property computation (Function effect_of_statement)");
+            break;
+    }
+    return dfvalue_of_stmt;
 }
 
-dfvalue
-identity_forward_node_flow(basic_block bb)
+/* The operands of stmt as the non-separable local properties see them:
+   the indices of its lvalue and of the two operands of its expression,
+   -1 where there is none or it is not a local variable, and whether the
+   value assigned is a constant. */
+
+static void
+operands_of_stmt_nonseparable(tree stmt, int * lval_index, int * left_opd_index,
+                              int * right_opd_index, bool * operand_is_constant)
 {
-        return CURRENT_IN(bb);
+        tree expr=NULL, left_opd=NULL, right_opd=NULL, lval=NULL;
+
+        *left_opd_index = *right_opd_index = -1;
+        *operand_is_constant = false;
+
+        /*Extract the lvalue of the stmt*/
+        lval = extract_lval(stmt);
+        *lval_index = find_index_of_local_var(lval);
+
+        /*Extract the expr of the stmt*/
+        expr = extract_expr(stmt);
+
+        if (expr)
+        {
+                left_opd = extract_operand(expr,0);
+                right_opd = extract_operand(expr,1);
+                *left_opd_index = find_index_of_local_var(left_opd);
+                *right_opd_index = find_index_of_local_var(right_opd);
+        } else {
+                if(TREE_CODE(stmt) == GIMPLE_MODIFY_STMT || TREE_CODE(stmt) == MODIFY_EXPR)
+                {
+                        expr = extract_operand(stmt,1);
+
+                        /* Check if the operand is constant, i.e stmts of type a =5.*/
+                        *operand_is_constant = IS_NODE_CONSTANT(expr) ? true : false;  
+
+                        /* Stmts of type a = b; or a = a; These are represented by left_opd_index > 0 and right_opd_index = -2.*/
+                        if(TREE_CODE(expr) == VAR_DECL) 
+                        {
+                                 left_opd = extract_operand(expr,0);
+                                 if(TREE_CODE(left_opd) == IDENTIFIER_NODE) 
+                                 {
+                                         *left_opd_index = find_index_of_local_var(expr); 
+                                 }
+                        }
+                }
+        }
 }
 
-dfvalue
-identity_backward_node_flow(basic_block bb)
+/* The part of GEN or KILL of stmt which does not depend on the value
+   flowing into it. The part which does is compiled by
+   compile_stmt_transfers. */
+
+static dfvalue
+var_in_statement_nonseparable(tree stmt, lp_specs_nonseparable lps)
 {
-        return CURRENT_OUT(bb);
+        dfvalue temp_Gen = NULL;
+        int lval_index=-1, left_opd_index=-1, right_opd_index=-1;
+        bool operand_is_constant = false;
+
+        if (lps.entity != entity_var)
+                report_dfa_spec_error ("Wrong choice of entity in local property computation (Function vars_in_statement)");
+
+        temp_Gen = make_initialised_dfvalue(ZEROS);
+        operands_of_stmt_nonseparable(stmt, &lval_index, &left_opd_index, &right_opd_index, 
+                                      &operand_is_constant);
+
+        switch (lps.stmt_effect)
+        {
+                case entity_mod:
+                        switch(lps.precondition) 
+                        {
+                                case X_IN_OPERAND: 
+                                        if(-1 != lval_index && (lval_index == left_opd_index || lval_index == right_opd_index)) 
+                                        {
+                                                set_dfvalue_bit(temp_Gen,lval_index);
+                                        }
+                                        break;
+                                case X_NOT_IN_OPERAND:
+                                        if(-1 != lval_index && (lval_index != left_opd_index && lval_index != right_opd_index)) 
+                                        {
+                                                set_dfvalue_bit(temp_Gen,lval_index);
+                                        }
+                                        break;
+                                case OPERAND_IS_CONST:
+                                        if(true == operand_is_constant) 
+                                        {
+                                                if(-1 != lval_index)
+                                                    set_dfvalue_bit(temp_Gen,lval_index);
+                                        }
+                                        break;
+                                case OPERAND_ISNOT_CONST:
+                                        break;
+                                case IGNORE_PRECONDITION:
+                                        break;
+                        }
+                        break;
+                case entity_use:
+                        switch(lps.precondition)
+                        {
+                                case X_IN_OPERAND:
+                                    break;
+                                case X_NOT_IN_OPERAND:
+                                    break;
+                                case OPERAND_IS_CONST:
+                                    if(true == operand_is_constant) 
+                                    {
+                                            if(-1 != lval_index)
+                                                    set_dfvalue_bit(temp_Gen,lval_index);
+                                    }
+                                    break;
+                                case OPERAND_ISNOT_CONST:
+                                    break;
+                                case IGNORE_PRECONDITION:
+                                    break;
+                        }
+                        switch(lps.read_or_use_stmt)
+                        {
+                                case READ_X:
+                                    break;
+                                case USE_X:
+                                    /*Condition Checking*/
+                                    if(-1 == lval_index) 
+                                    {
+                                            if(-1 != left_opd_index)
+                                                    set_dfvalue_bit(temp_Gen,left_opd_index);
+                                            if(-1 != right_opd_index)
+                                                    set_dfvalue_bit(temp_Gen,right_opd_index);
+                                    }           
+                                    break;
+                                case IGNORE_STATEMENT_TYPE:
+                                    break;
+                        }
+                        break;
+                default:
+                        report_dfa_spec_error ("Wrong entity manipulation in local property computation (Function vars_in_statement_nonseparable)");
+                        break;
+        }
+        return temp_Gen;
+}
+
+static void
+compile_stmt_transfer(stmt_transfer * transfer, lp_specs_nonseparable lps, tree stmt)
+{
+        int lval_index, left_opd_index, right_opd_index;
+        bool operand_is_constant, tests_lval;
+
+        transfer->test[0] = transfer->test[1] = -1;
+        transfer->effect[0] = transfer->effect[1] = -1;
+        transfer->when_in = false;
+
+        if (lps.entity != entity_var || lps.dependence == IGNORE_ENTITY_DEPENDENCE
+            || (lps.stmt_effect != entity_mod && lps.stmt_effect != entity_use))
+                return;
+
+        operands_of_stmt_nonseparable(stmt, &lval_index, &left_opd_index, &right_opd_index, 
+                                      &operand_is_constant);
+        tests_lval = (lps.dependence == X_IN_GLOBAL_DATA_FLOW_VALUE 
+                      || lps.dependence == X_NOT_IN_GLOBAL_DATA_FLOW_VALUE);
+        if (-1 == lval_index && (tests_lval || lps.stmt_effect == entity_mod))
+                return;
+
+        transfer->when_in = (lps.dependence == X_IN_GLOBAL_DATA_FLOW_VALUE 
+                             || lps.dependence == OPER_IN_GLOBAL_DATA_FLOW_VALUE);
+        if (tests_lval)
+                transfer->test[0] = lval_index;
+        else
+        {
+                transfer->test[0] = left_opd_index;
+                transfer->test[1] = right_opd_index;
+        }
+        if (lps.stmt_effect == entity_mod)
+                transfer->effect[0] = lval_index;
+        else
+        {
+                transfer->effect[0] = left_opd_index;
+                transfer->effect[1] = right_opd_index;
+        }
+}
+
+/* The part of GEN or KILL of stmt which does not depend on the value
+   flowing into it, as a transfer which tests nothing and so always
+   applies. Returns false if that part has more than two entities,
+   which a transfer cannot hold. */
+
+static bool
+compile_const_stmt_transfer(stmt_transfer * transfer, lp_specs_nonseparable lps, tree stmt)
+{
+        dfvalue value;
+        int entity, k = 0;
+        bool fits = true;
+
+        transfer->test[0] = transfer->test[1] = -1;
+        transfer->effect[0] = transfer->effect[1] = -1;
+        transfer->when_in = false;
+
+        if (!(value = local_dfa_of_stmt(lps, stmt)))
+                return true;
+        for (entity = next_dfvalue_member(value, 0); entity >= 0 && fits; 
+             entity = next_dfvalue_member(value, entity + 1))
+        {
+                if (k == 2)
+                        fits = false;
+                else
+                        transfer->effect[k++] = entity;
+        }
+        free_dfvalue_space(value);
+        return fits;
+}
+
+/* Compiles the constant parts of GEN and KILL of every statement for
+   the statements replayed from the boundaries of basic blocks. Returns
+   false, compiling none, if some statement has more than two constant
+   entities; the values of every statement are then kept instead (see
+   gdfa_driver). */
+
+static bool
+compile_const_stmt_transfers(void)
+{
+        int iter;
+
+        const_gen_transfer_of_stmt = XNEWVEC(stmt_transfer, MAX(local_stmt_count,1));
+        const_kill_transfer_of_stmt = XNEWVEC(stmt_transfer, MAX(local_stmt_count,1));
+        for (iter=0; iter < local_stmt_count; iter++)
+        {
+                if (!compile_const_stmt_transfer(&const_gen_transfer_of_stmt[iter], gen_lps, 
+                                                 local_stmt_list[iter])
+                    || !compile_const_stmt_transfer(&const_kill_transfer_of_stmt[iter], kill_lps,
+                                                    local_stmt_list[iter]))
+                {
+                        XDELETEVEC(const_gen_transfer_of_stmt);
+                        XDELETEVEC(const_kill_transfer_of_stmt);
+                        const_gen_transfer_of_stmt = const_kill_transfer_of_stmt = NULL;
+                        return false;
+                }
+        }
+        return true;
+}
+
+static void
+compile_stmt_transfers(void)
+{
+        basic_block bb;
+        block_stmt_iterator bsi;
+        int iter, nid, count = 0;
+
+        gen_transfer_of_stmt = XNEWVEC(stmt_transfer, local_stmt_count);
+        kill_transfer_of_stmt = XNEWVEC(stmt_transfer, local_stmt_count);
+        for (iter=0; iter < local_stmt_count; iter++)
+        {
+                compile_stmt_transfer(&gen_transfer_of_stmt[iter], gen_lps, local_stmt_list[iter]);
+                compile_stmt_transfer(&kill_transfer_of_stmt[iter], kill_lps, local_stmt_list[iter]);
+        }
+
+        first_stmt_of_bb = XNEWVEC(int, number_of_nodes + 1);
+        stmts_of_bbs = XNEWVEC(int, local_stmt_count);
+        for (nid=0; nid < number_of_nodes; nid++)
+        {
+                first_stmt_of_bb[nid] = count;
+                bb = BASIC_BLOCK(nid);
+                if (bb == NULL || nid < NUM_FIXED_BLOCKS)
+                        continue;
+                FOR_EACH_STMT_FWD
+                        if ((iter = find_index_of_local_stmt(bsi_stmt(bsi))) != -1)
+                                stmts_of_bbs[count++] = iter;
+        }
+        first_stmt_of_bb[number_of_nodes] = count;
+
+        replayed_bbs = sbitmap_alloc(number_of_nodes);
+        sbitmap_zero(replayed_bbs);
+        changed_entities = XNEWVEC(unsigned int, relevant_pfbv_entity_count);
+        next_changed_entities = XNEWVEC(unsigned int, relevant_pfbv_entity_count);
+        entity_stamp = XCNEWVEC(int, relevant_pfbv_entity_count);
+        replay_stamp = 0;
+
+        if (stmt_replay)
+                connect_stmt_replay();
+}
+
+static bool
+stmt_transfer_applies_p(stmt_transfer * transfer, dfvalue value)
+{
+        bool in = false;
+        int k;
+
+        if (transfer->effect[0] == -1 && transfer->effect[1] == -1)
+                return false;
+        for (k = 0; k < 2; k++)
+                if (transfer->test[k] != -1 && dfvalue_bit_p(value, transfer->test[k]))
+                        in = true;
+        return in == transfer->when_in;
+}
+
+/* Applies statement stmt_index to result: GEN + (result - KILL), where
+   GEN and KILL include the entities of the transfers whose tests
+   succeed on the value flowing into the statement. */
+
+static void
+apply_stmt_transfers(dfvalue result, int stmt_index)
+{
+        stmt_transfer * gen = &gen_transfer_of_stmt[stmt_index];
+        stmt_transfer * kill = &kill_transfer_of_stmt[stmt_index];
+        dfvalue gen_of_stmt = GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt, stmt_index);
+        bool generates = stmt_transfer_applies_p(gen, result);
+        bool kills = stmt_transfer_applies_p(kill, result);
+        int k;
+
+        a_plus_b_minus_c_into(result, gen_of_stmt, result, 
+                              KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt, stmt_index));
+        for (k = 0; k < 2; k++)
+                if (kills && kill->effect[k] != -1 && !dfvalue_bit_p(gen_of_stmt, kill->effect[k]))
+                        reset_dfvalue_bit(result, kill->effect[k]);
+        for (k = 0; k < 2; k++)
+                if (generates && gen->effect[k] != -1)
+                        set_dfvalue_bit(result, gen->effect[k]);
+}
+
+/* Frees what the statement storage has not taken over (see
+   preserve_replayed_dfi). */
+
+static void
+free_stmt_transfers(void)
+{
+        if (!replayed_bbs)
+                return;
+        XDELETEVEC(gen_transfer_of_stmt);
+        XDELETEVEC(kill_transfer_of_stmt);
+        XDELETEVEC(const_gen_transfer_of_stmt);
+        XDELETEVEC(const_kill_transfer_of_stmt);
+        XDELETEVEC(first_stmt_of_bb);
+        XDELETEVEC(stmts_of_bbs);
+        gen_transfer_of_stmt = kill_transfer_of_stmt = NULL;
+        const_gen_transfer_of_stmt = const_kill_transfer_of_stmt = NULL;
+        first_stmt_of_bb = stmts_of_bbs = NULL;
+
+        sbitmap_free(replayed_bbs);
+        XDELETEVEC(changed_entities);
+        XDELETEVEC(next_changed_entities);
+        XDELETEVEC(entity_stamp);
+        replayed_bbs = NULL;
+        changed_entities = next_changed_entities = NULL;
+        entity_stamp = NULL;
+}
+
+/* Statement level replay of the node flow of a non-separable analysis.
+   Once the statements of a basic block have been evaluated in full, the
+   values kept at them are those of the latest visit. A later visit only
+   pushes the entities in which the value entering the basic block
+   differs from the one kept at its first statement through the
+   statements, in the direction of the analysis, and stops at the first
+   statement after which nothing differs any more. At each statement
+   only the changed entities are recomputed, together with the entities
+   of those transfers whose tests read a changed entity; the other
+   transfers cannot have changed their outcome. The work of a visit is
+   thus proportional to the changes rather than to the number of
+   statements times the size of the universe. The values kept at the
+   statements change exactly as a full evaluation would change them, so
+   change_at_in_out_of_stmt, and with it the iteration counts, are the
+   same.
+*/
+
+static void
+flip_dfvalue_bit(dfvalue value, int entity)
+{
+        if (dfvalue_bit_p(value, entity))
+                reset_dfvalue_bit(value, entity);
+        else
+                set_dfvalue_bit(value, entity);
+}
+
+static bool
+stmt_transfer_reads_changes_p(stmt_transfer * transfer)
+{
+        int k;
+
+        for (k = 0; k < 2; k++)
+                if (transfer->test[k] != -1 && entity_stamp[transfer->test[k]] == replay_stamp)
+                        return true;
+        return false;
+}
+
+/* Recomputes entity in the value after statement stmt_index from the
+   value before it, as apply_stmt_transfers would, and notes it in
+   next_changed_entities if it has changed. */
+
+static void
+replay_entity(int stmt_index, dfvalue before, dfvalue after, int entity, 
+              bool generates, bool kills, int * count)
+{
+        stmt_transfer * gen = &gen_transfer_of_stmt[stmt_index];
+        stmt_transfer * kill = &kill_transfer_of_stmt[stmt_index];
+        bool member;
+
+        member = dfvalue_bit_p(GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt, stmt_index), entity)
+                 || (generates && (gen->effect[0] == entity || gen->effect[1] == entity))
+                 || (dfvalue_bit_p(before, entity)
+                     && !dfvalue_bit_p(KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt, stmt_index), entity)
+                     && !(kills && (kill->effect[0] == entity || kill->effect[1] == entity)));
+        if (member == dfvalue_bit_p(after, entity))
+                return;
+        flip_dfvalue_bit(after, entity);
+        next_changed_entities[(*count)++] = entity;
+}
+
+/* Applies the count changed entities to the value before statement
+   stmt_index and replays the statement. Returns the number of entities
+   changed after it, which are then in changed_entities. */
+
+static int
+replay_stmt(int stmt_index, dfvalue before, dfvalue after, int count)
+{
+        stmt_transfer * gen = &gen_transfer_of_stmt[stmt_index];
+        stmt_transfer * kill = &kill_transfer_of_stmt[stmt_index];
+        bool generates, kills;
+        unsigned int * swap;
+        int k, next_count = 0;
+
+        replay_stamp++;
+        for (k = 0; k < count; k++)
+        {
+                flip_dfvalue_bit(before, changed_entities[k]);
+                entity_stamp[changed_entities[k]] = replay_stamp;
+        }
+
+        generates = stmt_transfer_applies_p(gen, before);
+        kills = stmt_transfer_applies_p(kill, before);
+        for (k = 0; k < count; k++)
+                replay_entity(stmt_index, before, after, changed_entities[k], generates, kills, &next_count);
+        if (stmt_transfer_reads_changes_p(gen))
+                for (k = 0; k < 2; k++)
+                        if (gen->effect[k] != -1)
+                                replay_entity(stmt_index, before, after, gen->effect[k], generates, kills, &next_count);
+        if (stmt_transfer_reads_changes_p(kill))
+                for (k = 0; k < 2; k++)
+                        if (kill->effect[k] != -1)
+                                replay_entity(stmt_index, before, after, kill->effect[k], generates, kills, &next_count);
+
+        swap = changed_entities;
+        changed_entities = next_changed_entities;
+        next_changed_entities = swap;
+        return next_count;
+}
+
+static void
+replay_stmts_of_bb(dfvalue result, dfvalue entry, int nid, bool forward)
+{
+        int first = first_stmt_of_bb[nid], last = first_stmt_of_bb[nid + 1];
+        int position, iter, count;
+        dfvalue after = entry;
+
+        if (first < last)
+        {
+                iter = stmts_of_bbs[forward ? first : last - 1];
+                count = dfvalue_differences(entry, forward ? IN_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter)
+                                                           : OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter),
+                                            changed_entities);
+                if (count > 0)
+                        change_at_in_out_of_stmt = true;
+
+                for (position = forward ? first : last - 1; 
+                     count > 0 && position >= first && position < last; 
+                     position += forward ? 1 : -1)
+                {
+                        iter = stmts_of_bbs[position];
+                        count = replay_stmt(iter, 
+                                            forward ? IN_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter)
+                                                    : OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter),
+                                            forward ? OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter)
+                                                    : IN_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter),
+                                            count);
+                }
+
+                iter = stmts_of_bbs[forward ? last - 1 : first];
+                after = forward ? OUT_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter)
+                                : IN_OF_STMT_nid(current_pfbv_dfi_of_stmt, iter);
+        }
+        copy_dfvalue_into(result, after);
+}
+
+/*@Non-separable : START*/
+/***************  Statement values at the boundaries of basic blocks ***************/
+
+/* Creates the statement storage of a non-separable analysis whose
+   statement values are kept at the boundaries of basic blocks (see
+   struct stmt_replay). */
+
+static dfi_storage *
+create_replayed_dfi_space(int count)
+{
+        dfi_storage * storage;
+        struct stmt_replay * replay;
+        int iter;
+
+        storage = XCNEW(dfi_storage);
+        storage->count = count;
+        storage->dfi = XCNEWVEC(pfbv_dfi *, MAX(count,1));
+        storage->nodes = XCNEWVEC(pfbv_dfi, MAX(count,1));
+        storage->replay = replay = XCNEW(struct stmt_replay);
+
+        replay->nodes = storage->nodes;
+        replay->delta.replay = replay;
+        replay->bb_count = number_of_nodes;
+        replay->stmt_count = count;
+        replay->entry_of_bb = XCNEWVEC(dfvalue, MAX(number_of_nodes,1));
+        replay->entry = make_dfvalue_slab(number_of_nodes, top_value_spec);
+        replay->exit = make_dfvalue_slab(number_of_nodes, top_value_spec);
+        replay->n_bits = relevant_pfbv_entity_count;
+        replay->top = make_unpooled_dfvalue(DENSE_DFVALUE, replay->n_bits);
+        initialise_dfvalue(replay->top, top_value_spec);
+        replay->keeps_local = true;
+        for (iter=0; iter < STMT_REPLAY_CACHE_BLOCKS; iter++)
+                replay->cache[iter].nid = -1;
+
+        for (iter=0; iter < count; iter++)
+        {
+                DFI_nid(storage->dfi,iter) = &storage->nodes[iter];
+                storage->nodes[iter].delta = &replay->delta;
+        }
+        return storage;
+}
+
+/* Points the replay state at the compiled transfers and the statements
+   of the basic blocks, which solve_entity_components replaces while it
+   solves a subproblem, and finds the basic block of every statement.
+   A statement in no basic block is never evaluated and keeps top. */
+
+static void
+connect_stmt_replay(void)
+{
+        struct stmt_replay * replay = stmt_replay;
+        int iter, nid, position;
+
+        replay->gen = gen_transfer_of_stmt;
+        replay->kill = kill_transfer_of_stmt;
+        replay->const_gen = const_gen_transfer_of_stmt;
+        replay->const_kill = const_kill_transfer_of_stmt;
+        replay->first_stmt_of_bb = first_stmt_of_bb;
+        replay->stmts_of_bbs = stmts_of_bbs;
+        if (replay->bb_of_stmt)
+                return;
+
+        replay->bb_of_stmt = XNEWVEC(int, MAX(local_stmt_count,1));
+        for (iter=0; iter < local_stmt_count; iter++)
+                replay->bb_of_stmt[iter] = -1;
+        for (nid=0; nid < number_of_nodes; nid++)
+                for (position = first_stmt_of_bb[nid]; position < first_stmt_of_bb[nid + 1]; position++)
+                        replay->bb_of_stmt[stmts_of_bbs[position]] = nid;
+        for (iter=0; iter < local_stmt_count; iter++)
+                if (replay->bb_of_stmt[iter] == -1)
+                        replay->nodes[iter].in = replay->nodes[iter].out = replay->top;
+}
+
+/* Applies statement stmt_index to value: the kills of its transfers
+   whose tests succeed on the value flowing into it, and then their
+   gens. This is GEN + (value - KILL) of apply_stmt_transfers with the
+   constant parts of GEN and KILL as transfers too. */
+
+static void
+apply_replayed_stmt(struct stmt_replay * replay, dfvalue value, int stmt_index)
+{
+        stmt_transfer * transfers[4];
+        bool applies[4];
+        int t, k;
+
+        transfers[0] = &replay->const_kill[stmt_index];
+        transfers[1] = &replay->kill[stmt_index];
+        transfers[2] = &replay->const_gen[stmt_index];
+        transfers[3] = &replay->gen[stmt_index];
+        for (t = 0; t < 4; t++)
+                applies[t] = stmt_transfer_applies_p(transfers[t], value);
+        for (t = 0; t < 4; t++)
+                for (k = 0; k < 2 && applies[t]; k++)
+                {
+                        if (transfers[t]->effect[k] == -1)
+                                continue;
+                        if (t < 2)
+                                reset_dfvalue_bit(value, transfers[t]->effect[k]);
+                        else
+                                set_dfvalue_bit(value, transfers[t]->effect[k]);
+                }
+}
+
+/* The node flow of basic block nid from entry when the statement values
+   are kept at the boundaries of basic blocks. Since the values of the
+   statements follow from the entry, they have changed whenever the
+   entry of a basic block with statements has, and on the first
+   evaluation unless they are all top, which change_at_in_out_of_stmt
+   records as the full evaluation of the statements would. */
+
+static void
+evaluate_stmts_at_boundaries(dfvalue result, dfvalue entry, int nid, bool forward)
+{
+        struct stmt_replay * replay = stmt_replay;
+        int first = replay->first_stmt_of_bb[nid], last = replay->first_stmt_of_bb[nid + 1];
+        dfvalue exit = dfvalue_of_slab(replay->exit, nid);
+        bool changed;
+        int position;
+
+        if (replay->entry_of_bb[nid] && is_dfvalue_equal(entry, replay->entry_of_bb[nid]))
+        {
+                copy_dfvalue_into(result, exit);
+                return;
+        }
+
+        forget_replayed_blocks(replay, nid);
+        replay->forward = forward;
+        copy_dfvalue_into(result, entry);
+        changed = (replay->entry_of_bb[nid] != NULL) || !is_dfvalue_equal(result, value_top);
+        for (position = first; position < last; position++)
+        {
+                apply_replayed_stmt(replay, result, 
+                                    replay->stmts_of_bbs[forward ? position : first + last - 1 - position]);
+                changed = changed || !is_dfvalue_equal(result, value_top);
+        }
+        if (first < last && changed)
+                change_at_in_out_of_stmt = true;
+
+        replay->entry_of_bb[nid] = dfvalue_of_slab(replay->entry, nid);
+        copy_dfvalue_into(replay->entry_of_bb[nid], entry);
+        copy_dfvalue_into(exit, result);
 }
 
-dfvalue
-stop_flow_along_node(basic_block bb)
+static void
+forget_replayed_block(struct stmt_replay * replay, struct replayed_block * block)
 {
-        return value_top;
+        pfbv_dfi * node;
+        int first = replay->first_stmt_of_bb[block->nid], last = replay->first_stmt_of_bb[block->nid + 1];
+        int position;
+
+        for (position = first; position < last; position++)
+        {
+                node = &replay->nodes[replay->stmts_of_bbs[position]];
+                node->gen = node->kill = node->in = node->out = NULL;
+        }
+        for (position = 0; position < 4 * (last - first); position++)
+                free_dfvalue_space(block->values[position]);
+        XDELETEVEC(block->values);
+        block->values = NULL;
+        block->nid = -1;
 }
 
-dfvalue
-stop_flow_along_edge(basic_block src, basic_block dest)
+/* Drops basic block nid, or every basic block if nid is -1, from the
+   blocks of replayed values. */
+
+static void
+forget_replayed_blocks(struct stmt_replay * replay, int nid)
 {
-        return value_top;
+        int iter;
+
+        for (iter=0; iter < STMT_REPLAY_CACHE_BLOCKS; iter++)
+                if (replay->cache[iter].nid != -1 && (nid == -1 || replay->cache[iter].nid == nid))
+                        forget_replayed_block(replay, &replay->cache[iter]);
 }
 
-dfvalue
-forward_gen_kill_node_flow(basic_block bb)
-{
-        dfvalue temp, gen_of_stmt, kill_of_stmt, old_in_dfvalue, old_out_dfvalue, new_in_dfvalue, new_out_dfvalue;
-        block_stmt_iterator bsi;
-        tree stmt = NULL;
-        bool change_at_in, change_at_out;
+/* The block of replayed values of basic block nid. If it is not cached
+   the statements of nid are replayed from its entry into the least
+   recently used block, and their nodes pointed at the values; the
+   statements of a basic block which has never been evaluated keep
+   top. */
 
-        temp = make_uninitialised_dfvalue();
-        new_out_dfvalue = CURRENT_IN(bb); 
+static struct replayed_block *
+replayed_block_of(struct stmt_replay * replay, int nid)
+{
+        struct replayed_block * block;
+        int first = replay->first_stmt_of_bb[nid], last = replay->first_stmt_of_bb[nid + 1];
+        int iter, position, stmt_index, k;
+        dfvalue value;
+        pfbv_dfi * node;
+
+        replay->uses++;
+        for (iter=0; iter < STMT_REPLAY_CACHE_BLOCKS; iter++)
+                if (replay->cache[iter].nid == nid)
+                {
+                        replay->cache[iter].last_use = replay->uses;
+                        return &replay->cache[iter];
+                }
 
-        if(true == is_nonseparable) 
+        block = &replay->cache[0];
+        for (iter=1; iter < STMT_REPLAY_CACHE_BLOCKS && block->nid != -1; iter++)
+                if (replay->cache[iter].nid == -1 || replay->cache[iter].last_use < block->last_use)
+                        block = &replay->cache[iter];
+        if (block->nid != -1)
+                forget_replayed_block(replay, block);
+
+        block->nid = nid;
+        block->last_use = replay->uses;
+        block->values = XNEWVEC(dfvalue, MAX(4 * (last - first),1));
+        for (iter=0; iter < 4 * (last - first); iter++)
+                block->values[iter] = make_unpooled_dfvalue(DENSE_DFVALUE, replay->n_bits);
+
+        value = replay->entry_of_bb[nid] ? replay->entry_of_bb[nid] : replay->top;
+        for (iter=0; iter < last - first; iter++)
         {
-                new_in_dfvalue = CURRENT_IN(bb);  
-                FOR_EACH_STMT_FWD
+                position = replay->forward ? first + iter : last - 1 - iter;
+                stmt_index = replay->stmts_of_bbs[position];
+                node = &replay->nodes[stmt_index];
+                node->gen = block->values[4 * iter];
+                node->kill = block->values[4 * iter + 1];
+                node->in = block->values[4 * iter + 2];
+                node->out = block->values[4 * iter + 3];
+
+                initialise_dfvalue(node->gen, ZEROS);
+                initialise_dfvalue(node->kill, ZEROS);
+                for (k = 0; k < 2; k++)
                 {
-                        stmt = bsi_stmt(bsi); 
-
-                        /*DEBUG*/ 
-                        //fprintf(dump_file,"\n");
-                        //print_generic_stmt(dump_file, stmt,0);
-
-                        if(-1 == find_index_of_local_stmt(stmt))  continue;                        
-                                               
-                        old_in_dfvalue = IN_OF_STMT(current_pfbv_dfi_of_stmt, stmt); 
-                        change_at_in = is_new_info(new_in_dfvalue, old_in_dfvalue);
-                        if(change_at_in)
-                        {
-                                IN_OF_STMT(current_pfbv_dfi_of_stmt,stmt) = new_in_dfvalue;
-                                if(old_in_dfvalue) free_dfvalue_space(old_in_dfvalue); 
-                        }
-
-                        gen_of_stmt  = update_gen_of_stmt(stmt, gen_lps,  new_in_dfvalue);
-                        kill_of_stmt = update_kill_of_stmt(stmt, kill_lps, new_in_dfvalue);
+                        if (replay->const_gen[stmt_index].effect[k] != -1)
+                                set_dfvalue_bit(node->gen, replay->const_gen[stmt_index].effect[k]);
+                        if (replay->const_kill[stmt_index].effect[k] != -1)
+                                set_dfvalue_bit(node->kill, replay->const_kill[stmt_index].effect[k]);
+                }
+                if (!replay->keeps_local)
+                        node->gen = node->kill = NULL;
+
+                copy_dfvalue_into(replay->forward ? node->in : node->out, value);
+                value = replay->forward ? node->out : node->in;
+                copy_dfvalue_into(value, replay->forward ? node->in : node->out);
+                if (replay->entry_of_bb[nid])
+                        apply_replayed_stmt(replay, value, stmt_index);
+        }
+        return block;
+}
 
-                        new_out_dfvalue = a_plus_b_minus_c(gen_of_stmt, new_in_dfvalue, kill_of_stmt); 
+/* GEN, KILL, IN or OUT of the statement of node, for side 0 to 3, as
+   read by the clients: the value in the block of replayed values of its
+   basic block, which becomes the most recently used one. The value
+   stays valid until the block is reused, that is at least until the
+   next basic block is replayed; a client that keeps it longer copies it
+   (see copy_decoded_dfvalue_into). A statement in no basic block has
+   top, which is never reused. */
 
-                        old_out_dfvalue = OUT_OF_STMT(current_pfbv_dfi_of_stmt, stmt);
-                        change_at_out = is_new_info(new_out_dfvalue, old_out_dfvalue);
-                        if (change_at_out)
-                        {
-                                OUT_OF_STMT(current_pfbv_dfi_of_stmt,stmt) = new_out_dfvalue;
-                                if (old_out_dfvalue) free_dfvalue_space(old_out_dfvalue);
-                        }
+static dfvalue
+read_replayed_dfvalue(struct stmt_replay * replay, pfbv_dfi * node, int side)
+{
+        int nid = replay->bb_of_stmt[node - replay->nodes];
 
-                        change_at_in_out_of_stmt = change_at_in_out_of_stmt || change_at_out || change_at_in;
-                        new_in_dfvalue = new_out_dfvalue;
-                }
-                temp = new_out_dfvalue;
-        } else {
-	        temp = a_plus_b_minus_c(CURRENT_GEN(bb), CURRENT_IN(bb), CURRENT_KILL(bb));
+        if (nid != -1)
+                replayed_block_of(replay, nid);
+        switch (side)
+        {
+                case 0:
+                        return node->gen;
+                case 1:
+                        return node->kill;
+                case 2:
+                        return node->in;
+                default:
+                        return node->out;
         }
-        return temp;
 }
 
+/* GEN of a statement, or its KILL if kill is true. */
+
 dfvalue
-backward_gen_kill_node_flow(basic_block bb)
+local_dfvalue_of_stmt(pfbv_dfi * node, bool kill)
 {
-        dfvalue temp, gen_of_stmt, kill_of_stmt, old_in_dfvalue, old_out_dfvalue, new_in_dfvalue, new_out_dfvalue;
-        block_stmt_iterator bsi;
-        tree stmt = NULL;
-        bool change_at_in, change_at_out;
+        struct stmt_replay * replay = node->delta ? node->delta->replay : NULL;
 
-        temp = make_uninitialised_dfvalue();
-        new_in_dfvalue = CURRENT_OUT(bb); 
+        if (replay)
+                return read_replayed_dfvalue(replay, node, kill ? 1 : 0);
+        return kill ? node->kill : node->gen;
+}
 
-        if(true == is_nonseparable) 
-        {
-                new_out_dfvalue = CURRENT_OUT(bb);  
-                FOR_EACH_STMT_BKD
-                {
-                        stmt = bsi_stmt(bsi); 
+/* Copies GEN of a statement, or its KILL if kill is true, into dest, as
+   copy_decoded_dfvalue_into does. */
 
-                        /*DEBUG*/ 
-                        //fprintf(dump_file,"\n");
-                        //print_generic_stmt(dump_file, stmt,0);
+bool
+copy_local_dfvalue_of_stmt_into(dfvalue dest, pfbv_dfi * node, bool kill)
+{
+        dfvalue value = local_dfvalue_of_stmt(node, kill);
 
-                        if(-1 == find_index_of_local_stmt(stmt))  continue;                        
-                        
-                        old_out_dfvalue = OUT_OF_STMT(current_pfbv_dfi_of_stmt, stmt); 
-                        change_at_out = is_new_info(new_out_dfvalue, old_out_dfvalue);
-                        if(change_at_out)
-                        {
-                                OUT_OF_STMT(current_pfbv_dfi_of_stmt,stmt) = new_out_dfvalue;
-                                if(old_out_dfvalue) free_dfvalue_space(old_out_dfvalue); 
-                        }
+        if (!value)
+                return false;
+        copy_dfvalue_into(dest, value);
+        return true;
+}
 
-                        gen_of_stmt  = update_gen_of_stmt(stmt, gen_lps, new_out_dfvalue);
-                        kill_of_stmt = update_kill_of_stmt(stmt, kill_lps,new_out_dfvalue);
+/* Preserves the statement storage whose values are kept at the
+   boundaries of basic blocks, which takes over the compiled transfers
+   and the statements of the basic blocks from free_stmt_transfers and
+   keeps the entries of the basic blocks interned. */
 
-                        new_in_dfvalue = a_plus_b_minus_c(gen_of_stmt, new_out_dfvalue, kill_of_stmt);
+static void
+preserve_replayed_dfi(dfi_to_be_preserved preserve)
+{
+        struct stmt_replay * replay = stmt_replay;
+        dfi_storage * storage = stmt_dfi_storage;
+        int nid;
 
-                        old_in_dfvalue = IN_OF_STMT(current_pfbv_dfi_of_stmt, stmt);
-                        change_at_in = is_new_info(new_in_dfvalue, old_in_dfvalue);
-                        if (change_at_in)
-                        {
-                                IN_OF_STMT(current_pfbv_dfi_of_stmt,stmt) = new_in_dfvalue;
-                                if (old_in_dfvalue) free_dfvalue_space(old_in_dfvalue);
-                        }
+        stmt_replay = NULL;
+        forget_replayed_blocks(replay, -1);
+        gen_transfer_of_stmt = kill_transfer_of_stmt = NULL;
+        const_gen_transfer_of_stmt = const_kill_transfer_of_stmt = NULL;
+        first_stmt_of_bb = stmts_of_bbs = NULL;
 
-                        change_at_in_out_of_stmt = change_at_in_out_of_stmt || change_at_out || change_at_in;
-                        new_out_dfvalue = new_in_dfvalue;
-                }
-                temp = new_in_dfvalue;
-        } else {
-	        temp = a_plus_b_minus_c(CURRENT_GEN(bb), CURRENT_OUT(bb), CURRENT_KILL(bb));
+        if (preserve == no_value)
+        {
+                free_stmt_replay(replay);
+                XDELETEVEC(storage->nodes);
+                XDELETEVEC(storage->dfi);
+                XDELETE(storage);
+                return;
         }
-
-        return temp;
+        if (preserve != global_only && preserve != all)
+                report_dfa_spec_error("Wrong choice of values to be preserved (Function preserve_dfi)");
+
+        for (nid=0; nid < replay->bb_count; nid++)
+                if (replay->entry_of_bb[nid])
+                        replay->entry_of_bb[nid] = intern_dfvalue(replay->entry_of_bb[nid]);
+        free_dfvalue_slab(replay->entry);
+        free_dfvalue_slab(replay->exit);
+        replay->entry = replay->exit = NULL;
+        replay->keeps_local = (preserve == all);
+
+        storage->of_bbs = false;
+        storage->next = preserved_dfi_storage;
+        preserved_dfi_storage = storage;
 }
 
-static dfvalue
-combine (dfvalue value1, dfvalue value2)
-{        
-        dfvalue temp;
+static void
+free_stmt_replay(struct stmt_replay * replay)
+{
+        int nid;
+
+        forget_replayed_blocks(replay, -1);
+        if (replay->entry)
+        {
+                free_dfvalue_slab(replay->entry);
+                free_dfvalue_slab(replay->exit);
+        }
+        else
+        {
+                for (nid=0; nid < replay->bb_count; nid++)
+                        if (replay->entry_of_bb[nid])
+                                release_interned_dfvalue(replay->entry_of_bb[nid]);
+        }
+        XDELETEVEC(replay->entry_of_bb);
+        XDELETEVEC(replay->gen);
+        XDELETEVEC(replay->kill);
+        XDELETEVEC(replay->const_gen);
+        XDELETEVEC(replay->const_kill);
+        XDELETEVEC(replay->first_stmt_of_bb);
+        XDELETEVEC(replay->stmts_of_bbs);
+        XDELETEVEC(replay->bb_of_stmt);
+        free_dfvalue_space(replay->top);
+        XDELETE(replay);
+}
+/*@Non-separable : END*/
 
+/*@Non-separable : START*/
+/***************  Sparse solution over SSA form ***************/
+
+/* A non-separable analysis of variables can also be solved on the SSA
+   form of a function, where every use of a variable is reached by the
+   single definition of one of its SSA names. The value of the entity of
+   a variable just after a definition is then a property of the SSA name
+   defined: in a forward analysis it is computed at the definition, in a
+   backward one it is the confluence of the values at the uses of the
+   name. gdfa_ssa_driver keeps one bit per SSA name instead of a dfvalue
+   over all variables at every statement.
+
+   Every name starts at the top value and can only fall to the other
+   value, the bottom of the confluence, once: when the part of the
+   transfer moving values towards bottom (GEN for UNION, KILL for
+   INTERSECTION) which does not depend on the value flowing in applies
+   to it, or when a name it depends on has fallen. In a forward analysis
+   a definition depends on the operands of its statement, or on the
+   arguments of its PHI node, through an OPER_ dependence; in a backward
+   one the operands and the arguments depend on the definition through
+   an X_ dependence. A worklist of fallen names thus solves the analysis
+   in time proportional to the number of names and uses. The entry value
+   holds for the default definitions of variables other than parameters,
+   and the exit value for names without uses.
+
+   A statement that defines no SSA name, or has a call or volatile
+   operands, is a use statement (USE_X), as a statement without a local
+   lvalue is for the dense analysis. Temporaries are SSA names like any
+   other variable of register type, so values flow through them.
+
+   Only variables of register type have SSA names of their own. Those
+   kept in memory, aggregates and variables whose address is taken are
+   reached through virtual operands, which the driver does not follow,
+   so their entities are taken at bottom, the conservative value, rather
+   than solved: ssa_name_in_ssa_dfi answers bottom for their names, and
+   in a forward analysis a definition whose statement reads memory
+   falls, since the value flowing in may come from such a variable. In
+   a backward one a statement writing memory defines no SSA name and is
+   a use statement already. The dense gdfa_driver solves these entities
+   exactly.
+
+   A specification that cannot be solved this way is reported, and
+   gdfa_ssa_driver then returns NULL without solving anything.
+*/
 
-        if (confluence == INTERSECTION)
-                temp = intersect_dfvalues(value1, value2);
-        else if (confluence == UNION)
-                temp = union_dfvalues(value1, value2);
-        else 
-                 report_dfa_spec_error ("Confluence can only be UNION or INTERSECTION (Function combine)");
+struct ssa_dfi_def
+{
+        bool top;               /* value of the names that have not fallen */
+        bitmap fallen;          /* versions of the names that have fallen */
+};
 
-        return temp;
-}
+static bitmap fallen_names = NULL;
+static tree * fallen_worklist = NULL;
+static int fallen_worklist_length = 0;
 
 static bool
-is_new_info(dfvalue prev_info,dfvalue new_info)
+is_ssa_use_stmt(tree stmt)
 {
-        if(!(is_dfvalue_equal(prev_info,new_info))) 
-                return true;
-        else return false;
+        return (SINGLE_SSA_TREE_OPERAND(stmt, SSA_OP_DEF) == NULL_TREE
+                || get_call_expr_in(stmt) != NULL_TREE
+                || stmt_ann(stmt)->has_volatile_ops);
 }
 
+/* Whether the part of the transfer of lps which does not depend on the
+   value flowing in applies to name, which stmt defines for entity_mod
+   and uses for entity_use. */
 
-/***************  Specification Driven Local Property Computation ***************/
-
-static void
-local_dfa_nonseparable(struct gimple_pfbv_dfa_spec dfa_spec)
+static bool
+ssa_constant_transfer_p(lp_specs_nonseparable lps, tree stmt, tree name)
 {
-        int iter;
-        tree stmt = NULL;
+        tree use;
+        ssa_op_iter iter;
+        bool in_operand = false;
 
-        for (iter=0; iter < local_stmt_count; iter++)
-        {
-                stmt                                                 = local_stmt_list[iter];
-                GEN_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter)       = local_dfa_of_stmt(gen_lps, stmt);
-                KILL_OF_STMT_nid(current_pfbv_dfi_of_stmt,iter)      = local_dfa_of_stmt(kill_lps, stmt);
-        }       
-}        
+        if (lps.stmt_effect == entity_use)
+                return lps.read_or_use_stmt == USE_X && is_ssa_use_stmt(stmt);
 
-static dfvalue 
-local_dfa_of_stmt(lp_specs_nonseparable lps_given, tree stmt)
-{
-    dfvalue dfvalue_of_stmt = NULL;
-    switch (lps_given.entity)
+        FOR_EACH_SSA_TREE_OPERAND(use, stmt, iter, SSA_OP_USE)
+                if (SSA_NAME_VAR(use) == SSA_NAME_VAR(name))
+                        in_operand = true;
+        switch (lps.precondition)
         {
-        case entity_var:
-            dfvalue_of_stmt = var_in_statement_nonseparable(stmt,lps_given, NULL);
-            break;
-        case entity_expr:
-            break;
-        case entity_defn:
-            break;
-        default :
-            report_dfa_spec_error ("Wrong choice of entity in local property computation (Function effect_of_statement)");
-            break;
-    }
-    return dfvalue_of_stmt;
+                case X_IN_OPERAND:
+                        return in_operand;
+                case X_NOT_IN_OPERAND:
+                        return !in_operand;
+                case OPERAND_IS_CONST:
+                        return (TREE_CODE(stmt) == GIMPLE_MODIFY_STMT 
+                                && IS_NODE_CONSTANT(GIMPLE_STMT_OPERAND(stmt, 1)));
+                default:
+                        return false;
+        }
 }
 
-static dfvalue
-var_in_statement_nonseparable(tree stmt, lp_specs_nonseparable lps, dfvalue global_dfv)
+/* Whether stmt reads a variable that is not of register type */
+
+static bool
+ssa_reads_memory_p(tree stmt)
 {
-        dfvalue temp_Gen = NULL, temp = NULL;
-        tree expr=NULL, left_opd=NULL, right_opd=NULL, lval=NULL;
-        int lval_index=-1, left_opd_index=-1, right_opd_index=-1;
-        bool operand_is_constant = false;
+        return !ZERO_SSA_OPERANDS(stmt, SSA_OP_VIRTUAL_USES);
+}
 
-        if (lps.entity != entity_var)
-                report_dfa_spec_error ("Wrong choice of entity in local property computation (Function vars_in_statement)");
+static void
+fall_ssa_name(tree name)
+{
+        if (TREE_CODE(name) != SSA_NAME || !is_gimple_reg(name)
+            || bitmap_bit_p(fallen_names, SSA_NAME_VERSION(name)))
+                return;
+        bitmap_set_bit(fallen_names, SSA_NAME_VERSION(name));
+        fallen_worklist[fallen_worklist_length++] = name;
+}
 
-        temp_Gen = make_initialised_dfvalue(ZEROS);
-        temp = make_initialised_dfvalue(ZEROS);
+ssa_dfi
+gdfa_ssa_driver(struct gimple_pfbv_dfa_spec dfa_spec)
+{
+        lp_specs_nonseparable lps;
+        initial_value bottom;
+        entity_dependence falling;
+        basic_block bb;
+        block_stmt_iterator bsi;
+        tree name, stmt, use;
+        ssa_op_iter iter;
+        imm_use_iterator imm_iter;
+        use_operand_p use_p;
+        unsigned int version;
+        int k, pops = 0;
+        ssa_dfi dfi;
+
+        lps.entity = dfa_spec.entity;
+        if (dfa_spec.confluence == UNION)
+        {
+                bottom = ONES;
+                lps.stmt_effect = dfa_spec.gen_effect;
+                lps.read_or_use_stmt = dfa_spec.constgen_statement_type;
+                lps.precondition = dfa_spec.constgen_precondition;
+                lps.dependence = dfa_spec.dependent_gen;
+        } else {
+                bottom = ZEROS;
+                lps.stmt_effect = dfa_spec.kill_effect;
+                lps.read_or_use_stmt = dfa_spec.constkill_statement_type;
+                lps.precondition = dfa_spec.constkill_precondition;
+                lps.dependence = dfa_spec.dependent_kill;
+        }
 
-        /*Extract the lvalue of the stmt*/
-        lval = extract_lval(stmt);
-        lval_index = find_index_of_local_var(lval);
+        if (dfa_spec.entity != entity_var || !IS_NONSEPARABLE(dfa_spec) || dfa_spec.top_value_spec == bottom)
+        {
+                report_dfa_spec_error ("Only non-separable analyses of variables starting from the identity of the confluence can be solved over SSA form (Function gdfa_ssa_driver)");
+                return NULL;
+        }
+        if (dfa_spec.traversal_order == FORWARD)
+                falling = (bottom == ONES) ? OPER_IN_GLOBAL_DATA_FLOW_VALUE : OPER_NOT_IN_GLOBAL_DATA_FLOW_VALUE;
+        else
+                falling = (bottom == ONES) ? X_IN_GLOBAL_DATA_FLOW_VALUE : X_NOT_IN_GLOBAL_DATA_FLOW_VALUE;
+        if (lps.dependence != falling
+            || lps.stmt_effect != (dfa_spec.traversal_order == FORWARD ? entity_mod : entity_use))
+        {
+                report_dfa_spec_error ("The dependence towards bottom does not follow the SSA edges in the direction of the analysis (Function gdfa_ssa_driver)");
+                return NULL;
+        }
 
-        /*Extract the expr of the stmt*/
-        expr = extract_expr(stmt);
+        dfi = XNEW(struct ssa_dfi_def);
+        dfi->top = (bottom == ZEROS);
+        dfi->fallen = BITMAP_ALLOC(NULL);
+        fallen_names = dfi->fallen;
+        fallen_worklist = XNEWVEC(tree, num_ssa_names);
+        fallen_worklist_length = 0;
 
-        if (expr)
+        /* The entry and exit values */
+        for (version = 1; version < num_ssa_names; version++)
         {
-                left_opd = extract_operand(expr,0);
-                right_opd = extract_operand(expr,1);
-                left_opd_index = find_index_of_local_var(left_opd);
-                right_opd_index = find_index_of_local_var(right_opd);
-        } else {
-                if(TREE_CODE(stmt) == GIMPLE_MODIFY_STMT || TREE_CODE(stmt) == MODIFY_EXPR)
+                name = ssa_name(version);
+                if (!name || !is_gimple_reg(name))
+                        continue;
+                if (dfa_spec.traversal_order == FORWARD)
                 {
-                        expr = extract_operand(stmt,1);
+                        if (dfa_spec.entry_info == bottom && IS_EMPTY_STMT(SSA_NAME_DEF_STMT(name))
+                            && TREE_CODE(SSA_NAME_VAR(name)) != PARM_DECL)
+                                fall_ssa_name(name);
+                } else if (dfa_spec.exit_info == bottom && has_zero_uses(name))
+                        fall_ssa_name(name);
+        }
 
-                        /* Check if the operand is constant, i.e stmts of type a =5.*/
-                        operand_is_constant = IS_NODE_CONSTANT(expr) ? true : false;  
+        /* The parts of the transfers which do not depend on the value flowing in */
+        FOR_EACH_BB(bb)
+                FOR_EACH_STMT_FWD
+                {
+                        stmt = bsi_stmt(bsi);
+                        if (dfa_spec.traversal_order == FORWARD)
+                        {
+                                name = SINGLE_SSA_TREE_OPERAND(stmt, SSA_OP_DEF);
+                                if (name && (ssa_constant_transfer_p(lps, stmt, name)
+                                             || ssa_reads_memory_p(stmt)))
+                                        fall_ssa_name(name);
+                        } else {
+                                FOR_EACH_SSA_TREE_OPERAND(use, stmt, iter, SSA_OP_USE)
+                                        if (ssa_constant_transfer_p(lps, stmt, use))
+                                                fall_ssa_name(use);
+                        }
+                }
 
-                        /* Stmts of type a = b; or a = a; These are represented by left_opd_index > 0 and right_opd_index = -2.*/
-                        if(TREE_CODE(expr) == VAR_DECL) 
+        /* The dependences */
+        while (fallen_worklist_length > 0)
+        {
+                name = fallen_worklist[--fallen_worklist_length];
+                pops++;
+                if (dfa_spec.traversal_order == FORWARD)
+                {
+                        FOR_EACH_IMM_USE_FAST(use_p, imm_iter, name)
                         {
-                                 left_opd = extract_operand(expr,0);
-                                 if(TREE_CODE(left_opd) == IDENTIFIER_NODE) 
-                                 {
-                                         left_opd_index = find_index_of_local_var(expr); 
-                                 }
+                                stmt = USE_STMT(use_p);
+                                if (TREE_CODE(stmt) == PHI_NODE)
+                                        fall_ssa_name(PHI_RESULT(stmt));
+                                else if ((use = SINGLE_SSA_TREE_OPERAND(stmt, SSA_OP_DEF)))
+                                        fall_ssa_name(use);
                         }
+                } else {
+                        stmt = SSA_NAME_DEF_STMT(name);
+                        if (TREE_CODE(stmt) == PHI_NODE)
+                        {
+                                for (k = 0; k < PHI_NUM_ARGS(stmt); k++)
+                                        fall_ssa_name(PHI_ARG_DEF(stmt, k));
+                        } else if (!IS_EMPTY_STMT(stmt))
+                                FOR_EACH_SSA_TREE_OPERAND(use, stmt, iter, SSA_OP_USE)
+                                        fall_ssa_name(use);
                 }
         }
 
+        XDELETEVEC(fallen_worklist);
+        fallen_worklist = NULL;
+        fallen_names = NULL;
 
-        switch (lps.stmt_effect)
+        if (dump_file && (flag_gdfa || flag_gdfa_details))
         {
-                case entity_mod:
-                        if(NULL == global_dfv)
-                        {
-                                switch(lps.precondition) 
-                                {
-                                        case X_IN_OPERAND: 
-                                                if(-1 != lval_index && (lval_index == left_opd_index || lval_index == right_opd_index)) 
-                                                {
-                                                        SET_BIT(temp_Gen,lval_index);
-                                                }
-                                                break;
-                    			case X_NOT_IN_OPERAND:
-                                                if(-1 != lval_index && (lval_index != left_opd_index && lval_index != right_opd_index)) 
-                                                {
-                                                        SET_BIT(temp_Gen,lval_index);
-                                                }
-                                                break;
-                                        case OPERAND_IS_CONST:
-                                                if(true == operand_is_constant) 
-                                                {
-                                                        if(-1 != lval_index)
-                                                            SET_BIT(temp_Gen,lval_index);
-                                                }
-                                                break;
-                                        case OPERAND_ISNOT_CONST:
-                                                break;
-                                        case IGNORE_PRECONDITION:
-                                                break;
-                                }
-                                switch(lps.read_or_use_stmt)
-                                {
-                                        case READ_X:
-                                                break;
-                                        case USE_X:
-                                                break;
-                                        case IGNORE_STATEMENT_TYPE:
-                                                break;
-                                }
-                        } else {
-                                switch(lps.dependence)
-                                {
-                                        case X_IN_GLOBAL_DATA_FLOW_VALUE:
-                                               if(-1 != lval_index) 
-                                               {
-                                                       SET_BIT(temp,lval_index);
-                                                       if(true == sbitmap_any_common_bits(temp, global_dfv))
-                                                               SET_BIT(temp_Gen,lval_index);
-                                               }
-                                               break;
-                                        case X_NOT_IN_GLOBAL_DATA_FLOW_VALUE:
-                                               if(-1 != lval_index) 
-                                               {
-                                                       SET_BIT(temp,lval_index);
-                                                       if(false == sbitmap_any_common_bits(temp, global_dfv))
-                                                               SET_BIT(temp_Gen,lval_index);
-                                               }
-                                               break;
-                                        case OPER_IN_GLOBAL_DATA_FLOW_VALUE:
-                                               if(-1 != lval_index) 
-                                               {
-                                                       if(-1 != left_opd_index)
-                                                               SET_BIT(temp,left_opd_index);
-                                                       if(-1 != right_opd_index)
-                                                               SET_BIT(temp,right_opd_index);
-                                                       if(true == sbitmap_any_common_bits(temp, global_dfv))
-                                                               SET_BIT(temp_Gen,lval_index);
-                                               }
-                                               break;
-                                        case OPER_NOT_IN_GLOBAL_DATA_FLOW_VALUE:
-                                               if(-1 != lval_index) 
-                                               {
-                                                       if(-1 != left_opd_index)
-                                                               SET_BIT(temp,left_opd_index);
-                                                       if(-1 != right_opd_index)
-                                                               SET_BIT(temp,right_opd_index);
-                                                       if(false == sbitmap_any_common_bits(temp, global_dfv))
-                                                               SET_BIT(temp_Gen,lval_index);
-                                               }
-                                               break;
-                                        case IGNORE_ENTITY_DEPENDENCE:
-                                               break;
-                                }
-                        }
-                        break;
-                case entity_use:
-                        if(NULL == global_dfv)
-                        { 
-                                switch(lps.precondition)
-                                {
-                                        case X_IN_OPERAND:
-                                            break;
-                                        case X_NOT_IN_OPERAND:
-                                            break;
-                                        case OPERAND_IS_CONST:
-                                            if(true == operand_is_constant) 
-                                            {
-                                                    if(-1 != lval_index)
-                                                            SET_BIT(temp_Gen,lval_index);
-                                            }
-                                            break;
-                                        case OPERAND_ISNOT_CONST:
-                                            break;
-                                        case IGNORE_PRECONDITION:
-                                            break;
-                                }
-                                switch(lps.read_or_use_stmt)
-                                {
-                                        case READ_X:
-                                            break;
-                                        case USE_X:
-                                            /*Condition Checking*/
-                                            if(-1 == lval_index) 
-                                            {
-                                                    if(-1 != left_opd_index)
-                                                            SET_BIT(temp_Gen,left_opd_index);
-                                                    if(-1 != right_opd_index)
-                                                            SET_BIT(temp_Gen,right_opd_index);
-                                            }           
-                                            break;
-                                        case IGNORE_STATEMENT_TYPE:
-                                            break;
-                                }
-                        } else {
-                                switch(lps.dependence)
-                                {
-                                        case X_IN_GLOBAL_DATA_FLOW_VALUE:
-                                               if(-1 != lval_index) 
-                                               {
-                                                       SET_BIT(temp,lval_index);
-                                                       if(true == sbitmap_any_common_bits(temp, global_dfv))
-                                                       {
-                                                               if(-1 != left_opd_index)
-                                                                       SET_BIT(temp_Gen,left_opd_index);
-                                                               if(-1 != right_opd_index)
-                                                                       SET_BIT(temp_Gen,right_opd_index);
-                                                       }
-                                               }
-                                            break;
-                                        case X_NOT_IN_GLOBAL_DATA_FLOW_VALUE:
-                                               if(-1 != lval_index) 
-                                               {
-                                                       SET_BIT(temp,lval_index);
-                                                       if(false == sbitmap_any_common_bits(temp, global_dfv))
-                                                       {
-                                                               if(-1 != left_opd_index)
-                                                                       SET_BIT(temp_Gen,left_opd_index);
-                                                               if(-1 != right_opd_index)
-                                                                       SET_BIT(temp_Gen,right_opd_index);
-                                                       }
-                                                }
-                                            break;
-                                        case OPER_IN_GLOBAL_DATA_FLOW_VALUE:
-                                                if(-1 != left_opd_index)     
-                                                        SET_BIT(temp,left_opd_index);
-                                                if(-1 != right_opd_index)     
-                                                        SET_BIT(temp,right_opd_index);
-                                                if(true == sbitmap_any_common_bits(temp, global_dfv))
-                                                {
-                                                        if(-1 != left_opd_index)
-                                                                SET_BIT(temp_Gen,left_opd_index);
-                                                        if(-1 != right_opd_index)
-                                                                SET_BIT(temp_Gen,right_opd_index);
-                                                }
-                                            break;
-                                        case OPER_NOT_IN_GLOBAL_DATA_FLOW_VALUE:
-                                                if(-1 != left_opd_index)     
-                                                        SET_BIT(temp,left_opd_index);
-                                                if(-1 != right_opd_index)     
-                                                        SET_BIT(temp,right_opd_index);
-                                                if(false == sbitmap_any_common_bits(temp, global_dfv))
-                                                {
-                                                        if(-1 != left_opd_index)
-                                                                SET_BIT(temp_Gen,left_opd_index);
-                                                        if(-1 != right_opd_index)
-                                                                SET_BIT(temp_Gen,right_opd_index);
-                                                }
-                                            break;
-                                        case IGNORE_ENTITY_DEPENDENCE:
-                                            break;
-                                }
-                                break;
-                        }
-                        break;
-                default:
-                        report_dfa_spec_error ("Wrong entity manipulation in local property computation (Function vars_in_statement_nonseparable)");
-                        break;
+                fprintf(dump_file, "\n SSA names = %d, Worklist pops = %d *******\n", num_ssa_names, pops);
+                dump_ssa_dfi(dump_file, dfi);
         }
-        ASSERT(temp_Gen);
-        return temp_Gen;
+        return dfi;
 }
 
-static dfvalue 
-update_gen_of_stmt(tree stmt, lp_specs_nonseparable lps_given, dfvalue globaldfv)
+/* The value of the entity of the variable of name just after its
+   definition; bottom for a name that is not of register type. */
+
+bool
+ssa_name_in_ssa_dfi(ssa_dfi dfi, tree name)
 {
-    dfvalue dep_dfvalue, const_dfvalue;
-    switch (lps_given.entity)
-    {
-        case entity_var:
-            dep_dfvalue = var_in_statement_nonseparable(stmt,lps_given, globaldfv);
-                        /*DEBUG*/
-                        //fprintf(dump_file,"depGen : ");
-                        //dump_entity_list(dump_file,dep_dfvalue);
-                        
-            const_dfvalue = GEN_OF_STMT(current_pfbv_dfi_of_stmt,stmt);
-            return union_dfvalues(dep_dfvalue, const_dfvalue);
-        case entity_expr:
-            /*To be implemented*/ 
-            break;
-        case entity_defn:
-            /*To be implemented*/ 
-            break;
-        default :
-            report_dfa_spec_error ("Wrong choice of entity in local property computation (Function effect_of_statement)");
-            break;
-    }
+        if (!is_gimple_reg(name))
+                return !dfi->top;
+        return dfi->top != bitmap_bit_p(dfi->fallen, SSA_NAME_VERSION(name));
 }
 
-static dfvalue
-update_kill_of_stmt(tree stmt, lp_specs_nonseparable lps_given, dfvalue globaldfv)
+void
+free_ssa_dfi(ssa_dfi dfi)
 {
-    dfvalue dep_dfvalue, const_dfvalue;
-    switch (lps_given.entity)
-        {
-        case entity_var:
-            dep_dfvalue = var_in_statement_nonseparable(stmt,lps_given, globaldfv);
-                        /*DEBUG*/
-                        //fprintf(dump_file,"depKill : ");
-                        //dump_entity_list(dump_file,dep_dfvalue);
-                        
-            const_dfvalue = KILL_OF_STMT(current_pfbv_dfi_of_stmt,stmt);
-            return union_dfvalues(dep_dfvalue, const_dfvalue);
-        case entity_expr:
-            /*To be implemented*/ 
-            break;
-        case entity_defn:
-            /*To be implemented*/ 
-            break;
-        default :
-            report_dfa_spec_error ("Wrong choice of entity in local property computation (Function effect_of_statement)");
-            break;
-    }
+        if (!dfi)
+                return;
+        BITMAP_FREE(dfi->fallen);
+        XDELETE(dfi);
 }
 
+void
+dump_ssa_dfi(FILE * file, ssa_dfi dfi)
+{
+        unsigned int version;
+        tree name;
+
+        fprintf(file, "\n SSA names holding the entity: ");
+        for (version = 1; version < num_ssa_names; version++)
+        {
+                name = ssa_name(version);
+                if (name && is_gimple_reg(name) && ssa_name_in_ssa_dfi(dfi, name))
+                {
+                        print_generic_expr(file, name, 0);
+                        fprintf(file, " ");
+                }
+        }
+        fprintf(file, "\n");
+}
+/*@Non-separable : END*/
 
 static void
 local_dfa(struct gimple_pfbv_dfa_spec dfa_spec)
@@ -1280,6 +5124,7 @@ local_dfa(struct gimple_pfbv_dfa_spec dfa_spec)
         basic_block bb;
         int iter;
         lp_specs gen_lps, kill_lps;
+        dfvalue temp;
 
         gen_lps.entity = dfa_spec.entity;
         gen_lps.stmt_effect = dfa_spec.gen_effect;
@@ -1294,13 +5139,14 @@ local_dfa(struct gimple_pfbv_dfa_spec dfa_spec)
                 bb = VARRAY_BB(dfs_ordered_basic_blocks,iter);
                 if (bb)
                 {        
-                         GEN(current_pfbv_dfi,bb) = local_dfa_of_bb(gen_lps, bb);
-                         KILL(current_pfbv_dfi,bb) = local_dfa_of_bb(kill_lps, bb);
-                }
-                else
-                {        
-                         GEN_nid(current_pfbv_dfi,iter) = make_initialised_dfvalue(ZEROS);
-                         KILL_nid(current_pfbv_dfi,iter) = make_initialised_dfvalue(ZEROS);
+                         temp = local_dfa_of_bb(gen_lps, bb);
+                         copy_dfvalue_into(GEN(current_pfbv_dfi,bb), temp);
+                         free_dfvalue_space(temp);
+                         temp = local_dfa_of_bb(kill_lps, bb);
+                         copy_dfvalue_into(KILL(current_pfbv_dfi,bb), temp);
+                         free_dfvalue_space(temp);
+                         compute_dfvalue_span(GEN(current_pfbv_dfi,bb));
+                         compute_dfvalue_span(KILL(current_pfbv_dfi,bb));
                 }
         }
 }
@@ -1460,7 +5306,7 @@ exprs_in_statement(tree stmt, lp_specs lps)
                case entity_use:
                         if (expr_index != -1)
                         {       
-                                SET_BIT(temp_Gen,expr_index);
+                                set_dfvalue_bit(temp_Gen,expr_index);
 
                                 /* Reset the bits of the expressions if its operand
                                       is modified by this statement */
@@ -1476,7 +5322,7 @@ exprs_in_statement(tree stmt, lp_specs lps)
                                                         {       
                                                                 case down_exp:
                                                                 case any_where:
-                                                                        RESET_BIT(temp_Gen,temp->expr_no);
+                                                                        reset_dfvalue_bit(temp_Gen,temp->expr_no);
                                                                         break;
                                                                 case up_exp:
                                                                         break;
@@ -1504,7 +5350,7 @@ exprs_in_statement(tree stmt, lp_specs lps)
                                                    statement but are modified by this 
                                                    statement.
                                                 */
-                                                SET_BIT(temp_Gen,temp->expr_no);
+                                                set_dfvalue_bit(temp_Gen,temp->expr_no);
                                         else
                                         {        /* Expression appearing in the statement
                                                    is included only if we are looking for
@@ -1514,7 +5360,7 @@ exprs_in_statement(tree stmt, lp_specs lps)
                                                 {        
                                                         case down_exp:
                                                         case any_where:
-                                                                SET_BIT(temp_Gen,temp->expr_no);
+                                                                set_dfvalue_bit(temp_Gen,temp->expr_no);
                                                                 break;
                                                     
                                                         case up_exp:
@@ -1567,7 +5413,7 @@ defn_in_statement(tree stmt, lp_specs lps)
                case entity_use:
                         if (defn_index >= 0 && defn_index < local_defn_count)
                         {       
-                                SET_BIT(temp_Gen,defn_index);
+                                set_dfvalue_bit(temp_Gen,defn_index);
 
                                 /* Reset the bits of the other definitions of lval */ 
  
@@ -1583,7 +5429,7 @@ defn_in_statement(tree stmt, lp_specs lps)
                                                         {       
                                                                 case down_exp:
                                                                 case any_where:
-                                                                        RESET_BIT(temp_Gen,temp->defn_no);
+                                                                        reset_dfvalue_bit(temp_Gen,temp->defn_no);
                                                                         break;
                                                                 case up_exp:
                                                                         break;
@@ -1606,7 +5452,7 @@ defn_in_statement(tree stmt, lp_specs lps)
                                 for(temp = defns_of_vars[lval_index];temp;temp=temp->next)
                                 {
                                         if (temp->defn_no != defn_index && temp->defn_no != -1)
-                                                SET_BIT(temp_Gen,temp->defn_no);
+                                                set_dfvalue_bit(temp_Gen,temp->defn_no);
                                  
                                 }
                         }
@@ -1680,15 +5526,15 @@ vars_in_statement(tree stmt, lp_specs lps)
         {        
                case entity_use:
                         if (left_opd_index != -1)
-                                SET_BIT(temp_Gen,left_opd_index);
+                                set_dfvalue_bit(temp_Gen,left_opd_index);
                         if (right_opd_index != -1)
-                                SET_BIT(temp_Gen,right_opd_index);
+                                set_dfvalue_bit(temp_Gen,right_opd_index);
                         switch (lps.exposition)
                         {       
                                 case down_exp:
                                 case any_where:
                                         if (lval_index != -1)
-                                                RESET_BIT(temp_Gen,lval_index);
+                                                reset_dfvalue_bit(temp_Gen,lval_index);
                                 break;
                                 case up_exp:
                                         break;
@@ -1699,7 +5545,7 @@ vars_in_statement(tree stmt, lp_specs lps)
                         break;
                 case entity_mod:
                         if (lval_index != -1)
-                                SET_BIT(temp_Gen,lval_index);
+                                set_dfvalue_bit(temp_Gen,lval_index);
                         switch (lps.exposition)
                         {        
                                 case down_exp:
@@ -1707,9 +5553,9 @@ vars_in_statement(tree stmt, lp_specs lps)
                                         break;
                                 case up_exp:
                                         if (left_opd_index != -1)
-                                                RESET_BIT(temp_Gen,left_opd_index);
+                                                reset_dfvalue_bit(temp_Gen,left_opd_index);
                                         if (right_opd_index != -1)
-                                                RESET_BIT(temp_Gen,right_opd_index);
+                                                reset_dfvalue_bit(temp_Gen,right_opd_index);
                                         break;
                                 default:
                                         report_dfa_spec_error ("Wrong choice of occurrence in local property computation (Function vars_in_statement)");
@@ -1738,6 +5584,27 @@ dump_dfi(FILE * file, bool in_iterations)
         basic_block bb;
         block_stmt_iterator bsi;
         tree stmt = NULL; 
+        pfbv_dfi ** compacted_dfi;
+        int * entities;
+        int count;
+
+        /* Values over a compacted universe are dumped at their original
+           bit positions */
+        if (compacted_entities)
+        {
+                expand_compacted_dfi();
+                compacted_dfi = current_pfbv_dfi;
+                entities = compacted_entities;
+                count = relevant_pfbv_entity_count;
+                current_pfbv_dfi = full_bb_dfi_storage->dfi;
+                relevant_pfbv_entity_count = full_entity_count;
+                compacted_entities = NULL;
+                dump_dfi(file, in_iterations);
+                compacted_entities = entities;
+                relevant_pfbv_entity_count = count;
+                current_pfbv_dfi = compacted_dfi;
+                return;
+        }
 
         FOR_EACH_BB(bb)
         {         
@@ -1902,7 +5769,7 @@ dump_entity_list(FILE * file, dfvalue value)
         
         for (i=0; i<relevant_pfbv_entity_count ; i++)
         {         
-                if (TEST_BIT(value,i))
+                if (dfvalue_bit_p(value,i))
                 {        
                         switch (relevant_pfbv_entity)
                         {       
@@ -1987,6 +5854,8 @@ print_entity_info(void)
 static void 
 print_initial_dfi(void)
 {
+        if (solving_components)
+                return;
         if (flag_gdfa || flag_gdfa_details)
         {
                 fprintf(dump_file, "\n Initial values ************************\n");
@@ -1996,11 +5865,20 @@ print_initial_dfi(void)
 }
 
 static void 
-print_final_dfi(int count)
+print_final_dfi(const char *count_name, int count)
 {
+        if (solving_components)
+        {
+                component_count_name = count_name;
+                if (solver == ROUND_ROBIN)
+                        component_count = MAX(component_count, count);
+                else
+                        component_count += count;
+                return;
+        }
         if (flag_gdfa || flag_gdfa_details)
         {
-                fprintf(dump_file, "\n Total Number of Iterations = %d *******\n",count);
+                fprintf(dump_file, "\n Total Number of %s = %d *******\n",count_name,count);
                 fprintf(dump_file, "\n Final values **************************\n");
                 dump_dfi(dump_file, false);
         }
@@ -2011,6 +5889,8 @@ print_final_dfi(int count)
 static void 
 print_per_iteration_dfi(int iteration)
 {
+        if (solving_components)
+                return;
         if (flag_gdfa_details)    
         {
                fprintf(dump_file, "\n Values after iteration %d *************\n",iteration);
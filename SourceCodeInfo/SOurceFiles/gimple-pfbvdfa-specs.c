@@ -84,8 +84,10 @@ struct gimple_pfbv_dfa_spec gdfa_ave =
         IGNORE_STATEMENT_TYPE,         /* constkill_statement_type*/
         IGNORE_PRECONDITION,           /* constkill_precondition  */
         IGNORE_ENTITY_DEPENDENCE,      /* dependent_gen           */
-        IGNORE_ENTITY_DEPENDENCE       /* dependent_kill          */
+        IGNORE_ENTITY_DEPENDENCE,      /* dependent_kill          */
         /*@Non-separable : END*/
+        ROUND_ROBIN,                   /* solver                  */
+        ADAPTIVE_DFVALUE               /* representation          */
 };
 
 static unsigned int
@@ -146,8 +148,10 @@ struct gimple_pfbv_dfa_spec gdfa_pav =
         IGNORE_STATEMENT_TYPE,         /* constkill_statement_type*/
         IGNORE_PRECONDITION,           /* constkill_precondition  */
         IGNORE_ENTITY_DEPENDENCE,      /* dependent_gen           */
-        IGNORE_ENTITY_DEPENDENCE       /* dependent_kill          */
+        IGNORE_ENTITY_DEPENDENCE,      /* dependent_kill          */
         /*@Non-separable : END*/
+        ROUND_ROBIN,                   /* solver                  */
+        DENSE_DFVALUE                  /* representation          */
 };
 
 static unsigned int
@@ -206,8 +210,10 @@ struct gimple_pfbv_dfa_spec gdfa_ant =
         IGNORE_STATEMENT_TYPE,         /* constkill_statement_type*/
         IGNORE_PRECONDITION,           /* constkill_precondition  */
         IGNORE_ENTITY_DEPENDENCE,      /* dependent_gen           */
-        IGNORE_ENTITY_DEPENDENCE       /* dependent_kill          */
+        IGNORE_ENTITY_DEPENDENCE,      /* dependent_kill          */
         /*@Non-separable : END*/
+        ROUND_ROBIN,                   /* solver                  */
+        ADAPTIVE_DFVALUE               /* representation          */
 };
 
 
@@ -266,8 +272,10 @@ struct gimple_pfbv_dfa_spec gdfa_lv =
         IGNORE_STATEMENT_TYPE,         /* constkill_statement_type*/
         IGNORE_PRECONDITION,           /* constkill_precondition  */
         IGNORE_ENTITY_DEPENDENCE,      /* dependent_gen           */
-        IGNORE_ENTITY_DEPENDENCE       /* dependent_kill          */
+        IGNORE_ENTITY_DEPENDENCE,      /* dependent_kill          */
         /*@Non-separable : END*/
+        ROUND_ROBIN,                   /* solver                  */
+        DENSE_DFVALUE                  /* representation          */
 };
 
 
@@ -353,8 +361,10 @@ struct gimple_pfbv_dfa_spec gdfa_pre =
         IGNORE_STATEMENT_TYPE,         /* constkill_statement_type*/
         IGNORE_PRECONDITION,           /* constkill_precondition  */
         IGNORE_ENTITY_DEPENDENCE,      /* dependent_gen           */
-        IGNORE_ENTITY_DEPENDENCE       /* dependent_kill          */
+        IGNORE_ENTITY_DEPENDENCE,      /* dependent_kill          */
         /*@Non-separable : END*/
+        ROUND_ROBIN,                   /* solver                  */
+        ADAPTIVE_DFVALUE               /* representation          */
 };
 
 
@@ -437,8 +447,10 @@ struct gimple_pfbv_dfa_spec gdfa_rd =
         IGNORE_STATEMENT_TYPE,         /* constkill_statement_type*/
         IGNORE_PRECONDITION,           /* constkill_precondition  */
         IGNORE_ENTITY_DEPENDENCE,      /* dependent_gen           */
-        IGNORE_ENTITY_DEPENDENCE       /* dependent_kill          */
+        IGNORE_ENTITY_DEPENDENCE,      /* dependent_kill          */
         /*@Non-separable : END*/
+        ROUND_ROBIN,                   /* solver                  */
+        SPARSE_DFVALUE                 /* representation          */
 };
 
 static unsigned int
@@ -500,7 +512,9 @@ struct gimple_pfbv_dfa_spec gdfa_fv =
         USE_X,                               /* constkill_statement_type*/
         IGNORE_PRECONDITION,                 /* constkill_precondition  */
         IGNORE_ENTITY_DEPENDENCE,            /* dependent_gen           */
-        X_NOT_IN_GLOBAL_DATA_FLOW_VALUE      /* dependent_kill          */
+        X_NOT_IN_GLOBAL_DATA_FLOW_VALUE,     /* dependent_kill          */
+        ROUND_ROBIN,                         /* solver                  */
+        ADAPTIVE_DFVALUE                     /* representation          */
 };
 
 
@@ -559,7 +573,9 @@ struct gimple_pfbv_dfa_spec gdfa_puv =
         READ_X,                                    /* constkill_statement_type*/
         OPERAND_IS_CONST,                          /* constkill_precondition  */
         OPER_IN_GLOBAL_DATA_FLOW_VALUE,            /* dependent_gen           */
-        OPER_NOT_IN_GLOBAL_DATA_FLOW_VALUE         /* dependent_kill          */
+        OPER_NOT_IN_GLOBAL_DATA_FLOW_VALUE,        /* dependent_kill          */
+        ROUND_ROBIN,                               /* solver                  */
+        DENSE_DFVALUE                              /* representation          */
 };
 
 
@@ -589,4 +605,74 @@ struct tree_opt_pass pass_gimple_pfbv_puv_dfa =
   0                                   /* letter */
 };
 
+/************* Faint variables and possibly uninitialised variables over SSA form *****************/
+
+/* The same specifications solved sparsely over the SSA names of the
+   function (see gdfa_ssa_driver), without a dfvalue at every statement.
+   These passes run with the early optimizations, and only when gdfa is
+   asked for with -fgdfa or -fgdfa-details. */
+
+ssa_dfi FV_ssa_dfi = NULL;
+ssa_dfi PUV_ssa_dfi = NULL;
+
+static bool
+gate_gimple_pfbv_ssa_dfa(void)
+{
+        return flag_gdfa || flag_gdfa_details;
+}
+
+static unsigned int
+gimple_pfbv_fv_ssa_dfa(void)
+{
+        free_ssa_dfi(FV_ssa_dfi);
+        FV_ssa_dfi = gdfa_ssa_driver(gdfa_fv);
+
+        return 0;
+}
+
+
+struct tree_opt_pass pass_gimple_pfbv_fv_ssa_dfa =
+{
+  "gdfa_fv_ssa",                      /* name */
+  gate_gimple_pfbv_ssa_dfa,           /* gate */
+  gimple_pfbv_fv_ssa_dfa,             /* execute */
+  NULL,                               /* sub */
+  NULL,                               /* next */
+  0,                                  /* static_pass_number */
+  0,                                  /* tv_id */
+  PROP_cfg | PROP_ssa,                /* properties_required */
+  0,                                  /* properties_provided */
+  0,                                  /* properties_destroyed */
+  0,                                  /* todo_flags_start */
+  0,                                  /* todo_flags_finish */
+  0                                   /* letter */
+};
+
+static unsigned int
+gimple_pfbv_puv_ssa_dfa(void)
+{
+        free_ssa_dfi(PUV_ssa_dfi);
+        PUV_ssa_dfi = gdfa_ssa_driver(gdfa_puv);
+
+        return 0;
+}
+
+
+struct tree_opt_pass pass_gimple_pfbv_puv_ssa_dfa =
+{
+  "gdfa_puv_ssa",                     /* name */
+  gate_gimple_pfbv_ssa_dfa,           /* gate */
+  gimple_pfbv_puv_ssa_dfa,            /* execute */
+  NULL,                               /* sub */
+  NULL,                               /* next */
+  0,                                  /* static_pass_number */
+  0,                                  /* tv_id */
+  PROP_cfg | PROP_ssa,                /* properties_required */
+  0,                                  /* properties_provided */
+  0,                                  /* properties_destroyed */
+  0,                                  /* todo_flags_start */
+  0,                                  /* todo_flags_finish */
+  0                                   /* letter */
+};
+
 /*@Non-separable : END*/
@@ -34,6 +34,9 @@
 #include "cfgloop.h"
 #include "cfglayout.h"
 #include "hashtab.h"
+#include "pointer-set.h"
+#include "obstack.h"
+#include "alloc-pool.h"
 #include "cgraph.h" 
 #include "assert.h" 
 #include "gimple-pfbvdfa.h"
@@ -125,7 +128,21 @@ tree * local_stmt_list = NULL;
 defn_index_list **defns_of_vars=NULL;
 
 varray_type dfs_ordered_basic_blocks = NULL; 
-basic_block * stack_bb=NULL;
+varray_type reverse_dfs_ordered_basic_blocks = NULL; 
+sbitmap reachable_basic_blocks = NULL;
+
+/* The lists of local entities and statements, the expression templates
+   and the index lists are needed only as long as the indices of the
+   function they were built for, so they are allocated on gdfa_obstack
+   rather than in garbage collected memory, and released together when
+   the next function is initialised. The trees they refer to belong to
+   the function, which keeps them alive.
+*/
+static struct obstack gdfa_obstack;
+static bool gdfa_obstack_initialised = false;
+
+static void * gdfa_alloc_cleared(size_t size);
+static void * gdfa_realloc(void * block, size_t old_size, size_t size);
 
 /**  Functions to assign indices to local expressions, variables, and definitions **/
 
@@ -149,17 +166,22 @@ static signed int index_of_operand(tree operand);
 static bool is_expr_in_template(expr_template **template, int iter, tree expr, tree op0, tree op1);
 static void validate_expr_index_list(void);
 
+/* Locality aware renumbering of the entities */
+#ifndef CLUSTER_GDFA_ENTITIES
+#define CLUSTER_GDFA_ENTITIES 0
+#endif
+#if CLUSTER_GDFA_ENTITIES
+static void cluster_entities(void);
+#endif
+
 
 /**  Functions to perform depth first numbering of gimple cfg  **/
 
 static varray_type add_to_varray_bb(varray_type to_varray, basic_block bb, int index);
 static void dfs_numbering_of_bb(void);
-static void dfs_numbering_of_bb_inner(basic_block bb);
-static void init_stack(int number_of_elements);
-static bool is_empty_stack_bb(void);
-static bool is_full_stack_bb(void);
-static void push_bb(basic_block bb);
-static basic_block pop_bb(void);
+static edge_iterator dfs_edges_of_bb(basic_block bb, bool on_reverse_cfg);
+static varray_type dfs_numbering_of_bb_inner(basic_block start_bb, bool on_reverse_cfg, 
+                                             const char *name, sbitmap visited);
 
 /**  Accessor functions for entities in gimple IR **/
 static var_scope type_of_var(tree var);
@@ -174,21 +196,50 @@ static bool is_valid_stmt(tree stmt);
 int find_index_of_local_stmt(tree stmt);
 /*@Non-separable : END*/
 
+/* Selection of the dfvalue kernels */
+#ifndef BENCHMARK_DFVALUE_KERNELS
+#define BENCHMARK_DFVALUE_KERNELS 0
+#endif
+static void select_dfvalue_kernels (void);
+#if BENCHMARK_DFVALUE_KERNELS
+static void benchmark_dfvalue_kernels (FILE *file);
+#endif
+
 static unsigned int
 init_gimple_pfbvdfa_execute (void)
 {
+        if (gdfa_obstack_initialised)
+                obstack_free(&gdfa_obstack, NULL);
+        gcc_obstack_init(&gdfa_obstack);
+        gdfa_obstack_initialised = true;
+        release_preserved_dfi();
+
         local_var_count=0;
         local_expr_count=0;
 	local_defn_count=0;
+        local_stmt_count=0;
         number_of_nodes = n_basic_blocks;
 
+        invalidate_cfg_orders();
+        ensure_cfg_orders();
+
         assign_indices_to_var();
         assign_indices_to_exprs();
 	assign_indices_to_defn();
+#if CLUSTER_GDFA_ENTITIES
+        cluster_entities();
+#endif
         assign_indices_to_stmt();
 
-        dfs_ordered_basic_blocks = NULL; 
-        dfs_numbering_of_bb();
+        select_dfvalue_kernels();
+#if BENCHMARK_DFVALUE_KERNELS
+        {
+                static bool benchmarked = false;
+                if (!benchmarked)
+                        benchmark_dfvalue_kernels(stderr);
+                benchmarked = true;
+        }
+#endif
         
         return 0;
 }
@@ -213,6 +264,26 @@ struct tree_opt_pass pass_init_gimple_pfbvdfa =
 
 /**  Functions to assign indices to local expressions, variables, and definitions **/
 
+static void *
+gdfa_alloc_cleared(size_t size)
+{
+        void * block = obstack_alloc(&gdfa_obstack, size);
+
+        memset(block, 0, size);
+        return block;
+}
+
+/* block, of old_size bytes on gdfa_obstack, grown to size bytes. The old
+   block is released with the obstack. */
+
+static void *
+gdfa_realloc(void * block, size_t old_size, size_t size)
+{
+        void * grown = gdfa_alloc_cleared(size);
+
+        memcpy(grown, block, old_size);
+        return grown;
+}
 
 static void 
 assign_indices_to_var(void)
@@ -222,7 +293,7 @@ assign_indices_to_var(void)
         size_t position=0;
 
         /*data structure to store all expression templates */
-        local_var_list = (tree *)ggc_alloc_cleared(sizeof(tree )*v_old_size_local);
+        local_var_list = (tree *)gdfa_alloc_cleared(sizeof(tree )*v_old_size_local);
 
         list = cfun->unexpanded_var_list;
         while (list) 
@@ -230,7 +301,7 @@ assign_indices_to_var(void)
                 if(local_var_count == v_old_size_local)
                 {
                         v_old_size_local += v_new_size_local;
-                        local_var_list =(tree *) ggc_realloc(local_var_list,sizeof(tree )*v_old_size_local);
+                        local_var_list =(tree *) gdfa_realloc(local_var_list,sizeof(tree )*local_var_count,sizeof(tree )*v_old_size_local);
                 }
                 vars = TREE_VALUE (list);
 
@@ -280,7 +351,7 @@ static void
 create_add_node_expr_index_list( int expr_index, expr_index_list **list,int index)
 {
         expr_index_list *temp=NULL;
-        temp=(expr_index_list*)ggc_alloc_cleared(sizeof(expr_index_list));
+        temp=XOBNEW(&gdfa_obstack, expr_index_list);
         temp->expr_no = expr_index;
         temp->next = NULL;
 
@@ -298,7 +369,7 @@ static void
 create_add_node_defn_index_list( int defn_index, defn_index_list **list,int index)
 {
         defn_index_list *temp=NULL;
-        temp=(defn_index_list*)ggc_alloc_cleared(sizeof(defn_index_list));
+        temp=XOBNEW(&gdfa_obstack, defn_index_list);
         temp->defn_no = defn_index;
         temp->next = NULL;
 
@@ -380,13 +451,13 @@ assign_indices_to_local_expr(tree expr)
         if(local_expr_count == e_old_size_local)
         {
                 e_old_size_local += e_new_size_local;
-                local_expr =(expr_template**) ggc_realloc(local_expr,sizeof(expr_template*)*e_old_size_local);
+                local_expr =(expr_template**) gdfa_realloc(local_expr,sizeof(expr_template*)*local_expr_count,sizeof(expr_template*)*e_old_size_local);
         }
                         
         if(iter_local_expr == local_expr_count)
         {
                 local_expr[local_expr_count] = NULL;
-                local_expr[local_expr_count] =(expr_template*)ggc_alloc_cleared(sizeof(expr_template));
+                local_expr[local_expr_count] =(expr_template*)gdfa_alloc_cleared(sizeof(expr_template));
                 local_expr[local_expr_count]->expr = expr;
                                                         
                 switch(TREE_CODE(op0))
@@ -445,12 +516,13 @@ assign_indices_to_exprs(void)
                 
 
         /*data structure to store all expression templates */
-        local_expr = (expr_template**)ggc_alloc_cleared(sizeof(expr_template*)*e_old_size_local);
+        local_expr = (expr_template**)gdfa_alloc_cleared(sizeof(expr_template*)*e_old_size_local);
 
 
         /*data structure to accumulate expressions of a given variable */
 
-        exprs_of_vars  =(expr_index_list**)ggc_alloc_cleared(sizeof(*exprs_of_vars)*local_var_count);
+        exprs_of_vars  =XOBNEWVEC(&gdfa_obstack, expr_index_list *, local_var_count);
+        memset(exprs_of_vars, 0, sizeof(*exprs_of_vars)*local_var_count);
      
         
         FOR_EACH_BB_FWD(ENTRY_BLOCK_PTR)
@@ -483,8 +555,8 @@ assign_indices_to_stmt(void)
         block_stmt_iterator bsi;
         tree stmt = NULL, lval = NULL;
 
-        /*data structure to store all statements TO DO : free local_stmt_list*/ 
-        local_stmt_list = (tree *)ggc_alloc_cleared(sizeof(tree )*s_old_size_local);
+        /*data structure to store all statements*/ 
+        local_stmt_list = (tree *)gdfa_alloc_cleared(sizeof(tree )*s_old_size_local);
 
         FOR_EACH_BB_FWD(ENTRY_BLOCK_PTR) 
         {
@@ -495,7 +567,7 @@ assign_indices_to_stmt(void)
                         {
                                 if(local_stmt_count == s_old_size_local) {
                                         s_old_size_local += s_new_size_local;
-                                        local_stmt_list =(tree *) ggc_realloc(local_stmt_list,sizeof(tree )*s_old_size_local);
+                                        local_stmt_list =(tree *) gdfa_realloc(local_stmt_list,sizeof(tree )*local_stmt_count,sizeof(tree )*s_old_size_local);
                                 }
 
                                 lval = extract_operand(stmt,0);
@@ -541,10 +613,11 @@ assign_indices_to_defn(void)
         tree stmt=NULL,lval=NULL;
 
 	/*data structure to store all definitions*/ 
-        local_defn_list = (tree *)ggc_alloc_cleared(sizeof(tree )*d_old_size_local);
+        local_defn_list = (tree *)gdfa_alloc_cleared(sizeof(tree )*d_old_size_local);
 
         /*data structure to accumulate definitions of a given variable */
-        defns_of_vars  =(defn_index_list**)ggc_alloc_cleared(sizeof(*defns_of_vars)*local_var_count);
+        defns_of_vars  =XOBNEWVEC(&gdfa_obstack, defn_index_list *, local_var_count);
+        memset(defns_of_vars, 0, sizeof(*defns_of_vars)*local_var_count);
  
         FOR_EACH_BB_FWD(ENTRY_BLOCK_PTR)
         {
@@ -559,7 +632,7 @@ assign_indices_to_defn(void)
 				if(local_defn_count == d_old_size_local)
 		                {
                 	   		d_old_size_local += d_new_size_local;
-                        		local_defn_list =(tree *) ggc_realloc(local_defn_list,sizeof(tree )*d_old_size_local);
+                        		local_defn_list =(tree *) gdfa_realloc(local_defn_list,sizeof(tree )*local_defn_count,sizeof(tree )*d_old_size_local);
                 		}
 
 				type = type_of_defn(stmt);
@@ -593,6 +666,199 @@ assign_indices_to_defn(void)
     
 }
 
+#if CLUSTER_GDFA_ENTITIES
+
+/* Locality aware renumbering of the entities, enabled by compiling this
+   file with -DCLUSTER_GDFA_ENTITIES=1. The functions above number the
+   entities in the order in which they are found, which scatters the
+   local properties of a basic block over the whole dfvalue.
+   cluster_entities renumbers the variables and the expressions in the
+   order of their first occurrence in reverse postorder, and the
+   definitions by their variable and then by their first occurrence,
+   so that the GEN and KILL of a basic block fall into a few words (see
+   compute_dfvalue_span). Entities that occur in no reachable basic
+   block follow the others in their old order. It is not the default
+   since it changes the bit vectors in the dumps.
+
+   It runs before assign_indices_to_stmt, which reuses the index of a
+   statement that is a definition.
+*/
+
+static const int * cluster_keys;
+static const int * cluster_subkeys;
+
+static int
+compare_cluster_keys(const void * p1, const void * p2)
+{
+        int i1 = *(const int *) p1, i2 = *(const int *) p2;
+
+        if (cluster_keys[i1] != cluster_keys[i2])
+                return cluster_keys[i1] < cluster_keys[i2] ? -1 : 1;
+        if (cluster_subkeys && cluster_subkeys[i1] != cluster_subkeys[i2])
+                return cluster_subkeys[i1] < cluster_subkeys[i2] ? -1 : 1;
+        return i1 - i2;
+}
+
+/* The new index of each of count entities, ordered by key and then by
+   subkey if it is not NULL */
+
+static int *
+cluster_order(int count, const int * key, const int * subkey)
+{
+        int * order = XNEWVEC(int, MAX(count,1));
+        int * new_index = XNEWVEC(int, MAX(count,1));
+        int iter;
+
+        for (iter=0; iter < count; iter++)
+                order[iter] = iter;
+        cluster_keys = key;
+        cluster_subkeys = subkey;
+        qsort(order, count, sizeof(int), compare_cluster_keys);
+        for (iter=0; iter < count; iter++)
+                new_index[order[iter]] = iter;
+        XDELETEVEC(order);
+        return new_index;
+}
+
+static void
+note_first_occurrence(int * first, int index, int position)
+{
+        if (index != -1 && first[index] > position)
+                first[index] = position;
+}
+
+static void
+cluster_entities(void)
+{
+        int * first_var, * first_expr, * first_defn, * var_of_defn;
+        int * new_var, * new_expr, * new_defn;
+        int iter, position = 0;
+        struct pointer_set_t * renumbered;
+        expr_index_list * expr_node;
+        defn_index_list * defn_node;
+        tree * old_vars, * old_defns;
+        expr_template ** old_exprs;
+        expr_index_list ** old_exprs_of_vars;
+        defn_index_list ** old_defns_of_vars;
+        block_stmt_iterator bsi;
+        tree stmt, expr, op;
+        basic_block bb;
+
+        first_var = XNEWVEC(int, MAX(local_var_count,1));
+        first_expr = XNEWVEC(int, MAX(local_expr_count,1));
+        first_defn = XNEWVEC(int, MAX(local_defn_count,1));
+        var_of_defn = XNEWVEC(int, MAX(local_defn_count,1));
+        for (iter=0; iter < local_var_count; iter++)
+                first_var[iter] = INT_MAX;
+        for (iter=0; iter < local_expr_count; iter++)
+                first_expr[iter] = INT_MAX;
+        for (iter=0; iter < local_defn_count; iter++)
+                first_defn[iter] = INT_MAX;
+
+        for (iter=0; iter < number_of_nodes; iter++)
+        {
+                bb = VARRAY_BB(dfs_ordered_basic_blocks, iter);
+                if (!bb)
+                        continue;
+                FOR_EACH_STMT_FWD
+                {
+                        stmt = bsi_stmt(bsi);
+                        position++;
+                        note_first_occurrence(first_var, find_index_of_local_var(extract_lval(stmt)), 
+                                              position);
+                        expr = extract_expr(stmt);
+                        if (expr && is_local_expr(expr))
+                        {
+                                note_first_occurrence(first_expr, ENTITY_INDEX(*expr), position);
+                                note_first_occurrence(first_var, 
+                                                      find_index_of_local_var(extract_operand(expr,0)), 
+                                                      position);
+                                note_first_occurrence(first_var, 
+                                                      find_index_of_local_var(extract_operand(expr,1)), 
+                                                      position);
+                        }
+                        else if (expr)
+                                note_first_occurrence(first_var, find_index_of_local_var(expr), position);
+                        note_first_occurrence(first_defn, find_index_of_local_defn(stmt), position);
+                }
+        }
+
+        new_var = cluster_order(local_var_count, first_var, NULL);
+        new_expr = cluster_order(local_expr_count, first_expr, NULL);
+        for (iter=0; iter < local_defn_count; iter++)
+                var_of_defn[iter] = new_var[ENTITY_INDEX(*extract_operand(local_defn_list[iter],0))];
+        new_defn = cluster_order(local_defn_count, var_of_defn, first_defn);
+
+        /* Variables, and the lists and templates indexed by them */
+        old_vars = XNEWVEC(tree, MAX(local_var_count,1));
+        old_exprs_of_vars = XNEWVEC(expr_index_list *, MAX(local_var_count,1));
+        old_defns_of_vars = XNEWVEC(defn_index_list *, MAX(local_var_count,1));
+        memcpy(old_vars, local_var_list, local_var_count * sizeof(tree));
+        memcpy(old_exprs_of_vars, exprs_of_vars, local_var_count * sizeof(expr_index_list *));
+        memcpy(old_defns_of_vars, defns_of_vars, local_var_count * sizeof(defn_index_list *));
+        for (iter=0; iter < local_var_count; iter++)
+        {
+                ENTITY_INDEX(*old_vars[iter]) = new_var[iter];
+                local_var_list[new_var[iter]] = old_vars[iter];
+                exprs_of_vars[new_var[iter]] = old_exprs_of_vars[iter];
+                defns_of_vars[new_var[iter]] = old_defns_of_vars[iter];
+                for (expr_node = exprs_of_vars[new_var[iter]]; expr_node; expr_node = expr_node->next)
+                        expr_node->expr_no = new_expr[expr_node->expr_no];
+                for (defn_node = defns_of_vars[new_var[iter]]; defn_node; defn_node = defn_node->next)
+                        defn_node->defn_no = new_defn[defn_node->defn_no];
+        }
+        for (iter=0; iter < local_expr_count; iter++)
+        {
+                op = extract_operand(local_expr[iter]->expr,0);
+                if (TREE_CODE(op) == VAR_DECL && local_expr[iter]->op0_index != -1)
+                        local_expr[iter]->op0_index = new_var[local_expr[iter]->op0_index];
+                op = extract_operand(local_expr[iter]->expr,1);
+                if (TREE_CODE(op) == VAR_DECL && local_expr[iter]->op1_index != -1)
+                        local_expr[iter]->op1_index = new_var[local_expr[iter]->op1_index];
+        }
+
+        /* Expressions. Every occurrence of an expression carries its
+           index; the set guards against trees shared by statements. */
+        old_exprs = XNEWVEC(expr_template *, MAX(local_expr_count,1));
+        memcpy(old_exprs, local_expr, local_expr_count * sizeof(expr_template *));
+        for (iter=0; iter < local_expr_count; iter++)
+                local_expr[new_expr[iter]] = old_exprs[iter];
+        renumbered = pointer_set_create();
+        FOR_EACH_BB_FWD(ENTRY_BLOCK_PTR)
+        {
+                FOR_EACH_STMT_FWD
+                {
+                        expr = extract_expr(bsi_stmt(bsi));
+                        if (expr && is_local_expr(expr) && !pointer_set_insert(renumbered, expr))
+                                ENTITY_INDEX(*expr) = new_expr[ENTITY_INDEX(*expr)];
+                }
+        }
+        pointer_set_destroy(renumbered);
+
+        /* Definitions */
+        old_defns = XNEWVEC(tree, MAX(local_defn_count,1));
+        memcpy(old_defns, local_defn_list, local_defn_count * sizeof(tree));
+        for (iter=0; iter < local_defn_count; iter++)
+        {
+                ENTITY_INDEX(*old_defns[iter]) = new_defn[iter];
+                local_defn_list[new_defn[iter]] = old_defns[iter];
+        }
+
+        XDELETEVEC(first_var);
+        XDELETEVEC(first_expr);
+        XDELETEVEC(first_defn);
+        XDELETEVEC(var_of_defn);
+        XDELETEVEC(new_var);
+        XDELETEVEC(new_expr);
+        XDELETEVEC(new_defn);
+        XDELETEVEC(old_vars);
+        XDELETEVEC(old_exprs);
+        XDELETEVEC(old_exprs_of_vars);
+        XDELETEVEC(old_defns_of_vars);
+}
+
+#endif /* CLUSTER_GDFA_ENTITIES */
+
 static void
 validate_expr_index_list(void)
 {
@@ -625,10 +891,27 @@ validate_expr_index_list(void)
  * for (i=maxdfs-1 ;i>= 0;i--)
  *  node = dfs_num[i]
  * we will store basic_blocks in dfs_numbered manner in varray dfs_ordered_basic_blocks
+ *
+ * The same numbering of the reverse CFG, starting from the exit block
+ * and following the predecessors, is stored in 
+ * reverse_dfs_ordered_basic_blocks. This is the reverse postorder of the
+ * reverse CFG, which is the preferred visiting order for backward
+ * analyses. The basic blocks reachable from the entry block are
+ * recorded in reachable_basic_blocks.
+ *
+ * In both varrays the basic blocks that are not reached by the traversal
+ * are not numbered and the corresponding leading slots stay NULL.
+ *
+ * The orders are computed once per function and shared by all the gdfa
+ * passes. ensure_cfg_orders recomputes them only if the function or
+ * the number of its basic blocks or edges has changed since they were
+ * computed; a pass that modifies the CFG without changing these numbers
+ * must call invalidate_cfg_orders.
 */
 
-static int dfs_num=0;
-static int *visit_dfs=NULL;
+static struct function * cfg_orders_fn = NULL;
+static int cfg_orders_n_basic_blocks = -1;
+static int cfg_orders_n_edges = -1;
 
 static varray_type 
 add_to_varray_bb(varray_type to_varray, basic_block bb, int index)
@@ -645,135 +928,111 @@ add_to_varray_bb(varray_type to_varray, basic_block bb, int index)
                         return to_varray;
 }
 
-
-static void
-dfs_numbering_of_bb(void)
+void
+invalidate_cfg_orders(void)
 {
-                VARRAY_BB_INIT (dfs_ordered_basic_blocks, number_of_nodes, "dfs_ordered_bb");
-                visit_dfs = (int*)ggc_alloc_cleared(sizeof(int)*number_of_nodes);
-                init_stack(number_of_nodes);
-                dfs_num = number_of_nodes;
-                basic_block bb = ENTRY_BLOCK_PTR;
-
-#if NON_RECURSIVE_DFS
-                push_bb(bb); visit_dfs[bb->index]=1; 
-#endif
-                dfs_numbering_of_bb_inner(bb);
-                visit_dfs = NULL;
-                stack_bb = NULL;
+        cfg_orders_fn = NULL;
+        cfg_orders_n_basic_blocks = -1;
+        cfg_orders_n_edges = -1;
 }
 
-#if NON_RECURSIVE_DFS
-static void 
-dfs_numbering_of_bb_inner(basic_block bb) /*non recursive one*/
+void
+ensure_cfg_orders(void)
 {
+        if (cfg_orders_fn == cfun
+            && cfg_orders_n_basic_blocks == n_basic_blocks
+            && cfg_orders_n_edges == n_edges)
+                return;
 
-        edge_iterator ei ;
-        edge e ;
-        basic_block succ_bb=NULL;
-        int bb_index; 
-        
-        push_bb(bb);
-        bb_index = find_index_bb(bb);
-        visit_dfs[bb_index]=1; 
+        number_of_nodes = n_basic_blocks;
+        dfs_numbering_of_bb();
 
-        do{
-                ei = ei_start(bb->succs);
-                for(;e=ei_safe_edge(ei);ei_next(&ei))
-                {
-                        succ_bb = e->dest;
-                        bb_index = find_index_bb(succ_bb);
-                        if(!visit_dfs[bb_index] && !(succ_bb->dfs_number >= 0 && succ_bb->dfs_number<number_of_nodes) )
-                        {
-                                push_bb(succ_bb);
-                                visit_dfs[bb_index]=1;
-                                bb = succ_bb;
-                                ei = ei_start(bb->succs);
-                        }
-                }
-        
-                bb = pop_bb();
-                VARRAY_BB(dfs_ordered_basic_blocks,--dfs_num) = bb;
-                bb->dfs_number = dfs_num;
-                bb_index = find_index_bb(bb);
-                visit_dfs[bb_index] = 0;
-                
-        }while(!is_empty_stack_bb());
+        cfg_orders_fn = cfun;
+        cfg_orders_n_basic_blocks = n_basic_blocks;
+        cfg_orders_n_edges = n_edges;
 }
 
-#else 
-
-static void 
-dfs_numbering_of_bb_inner(basic_block bb) /* Recursive version */
+static void
+dfs_numbering_of_bb(void)
 {
+        sbitmap visited = sbitmap_alloc(number_of_nodes);
 
-        edge_iterator ei ;
-        edge e ;
-        basic_block succ_bb=NULL;
-
-        visit_dfs[bb->index] = 1;
-
-
-        FOR_EACH_EDGE(e,ei,bb->succs)
-        {
-                succ_bb = e->dest;
-                if(!visit_dfs[succ_bb->index])
-                dfs_numbering_of_bb_inner(succ_bb);
-        }
+        if (reachable_basic_blocks)
+                sbitmap_free(reachable_basic_blocks);
+        reachable_basic_blocks = sbitmap_alloc(number_of_nodes);
 
-        VARRAY_BB(dfs_ordered_basic_blocks,--dfs_num) = bb;
-        bb->dfs_number = dfs_num;
+        dfs_ordered_basic_blocks = 
+                dfs_numbering_of_bb_inner(ENTRY_BLOCK_PTR, false, "dfs_ordered_bb", reachable_basic_blocks);
+        reverse_dfs_ordered_basic_blocks = 
+                dfs_numbering_of_bb_inner(EXIT_BLOCK_PTR, true, "reverse_dfs_ordered_bb", visited);
 
+        sbitmap_free(visited);
 }
-#endif
-
-static signed int bb_stack_top=-1;
 
-static void
-init_stack(int number_of_elements)
-{
-        stack_bb = NULL;
-        stack_bb = (basic_block*)ggc_alloc_cleared(sizeof(basic_block)*number_of_elements);
-        bb_stack_top = -1;
-}
-static bool
-is_empty_stack_bb(void)
-{
-        if(bb_stack_top == -1)
-        return true;
-        else
-        return false;
-}
-static bool
-is_full_stack_bb(void)
+static edge_iterator
+dfs_edges_of_bb(basic_block bb, bool on_reverse_cfg)
 {
-        if(bb_stack_top == number_of_nodes-1)
-        return true;
+        if (on_reverse_cfg)
+                return ei_start(bb->preds);
         else
-        return false;
-}
-static void
-push_bb(basic_block bb)
-{
-        if(!is_full_stack_bb())
-        {
-                stack_bb[++bb_stack_top]=bb;
-        }
+                return ei_start(bb->succs);
 }
 
-static basic_block
-pop_bb(void)
+/* Non recursive depth first traversal from start_bb along the successors
+   (or the predecessors if on_reverse_cfg is true). The explicit stack
+   holds a basic block and the iterator over its remaining edges for every
+   basic block on the current path, and a basic block is numbered when
+   its edges are exhausted. Hence the numbering is identical to that of
+   the recursive traversal but does not depend on the depth of the
+   machine stack. 
+*/
+static varray_type
+dfs_numbering_of_bb_inner(basic_block start_bb, bool on_reverse_cfg, 
+                          const char *name, sbitmap visited)
 {
-        basic_block bb;
-        if(!is_empty_stack_bb())
+        varray_type ordered_basic_blocks;
+        basic_block *stack_bb;
+        edge_iterator *stack_ei;
+        int stack_top = 0, dfs_num = number_of_nodes;
+        basic_block bb, next_bb;
+
+        VARRAY_BB_INIT (ordered_basic_blocks, number_of_nodes, name);
+        stack_bb = XNEWVEC(basic_block, number_of_nodes);
+        stack_ei = XNEWVEC(edge_iterator, number_of_nodes);
+        sbitmap_zero(visited);
+
+        SET_BIT(visited, find_index_bb(start_bb));
+        stack_bb[stack_top] = start_bb;
+        stack_ei[stack_top++] = dfs_edges_of_bb(start_bb, on_reverse_cfg);
+
+        while (stack_top > 0)
         {
-                bb = stack_bb[bb_stack_top];
-                bb_stack_top--;        
+                bb = stack_bb[stack_top - 1];
+                if (!ei_end_p(stack_ei[stack_top - 1]))
+                {
+                        next_bb = on_reverse_cfg ? ei_edge(stack_ei[stack_top - 1])->src 
+                                                 : ei_edge(stack_ei[stack_top - 1])->dest;
+                        ei_next(&stack_ei[stack_top - 1]);
+
+                        if (!TEST_BIT(visited, find_index_bb(next_bb)))
+                        {
+                                SET_BIT(visited, find_index_bb(next_bb));
+                                stack_bb[stack_top] = next_bb;
+                                stack_ei[stack_top++] = dfs_edges_of_bb(next_bb, on_reverse_cfg);
+                        }
+                }
+                else
+                {
+                        stack_top--;
+                        VARRAY_BB(ordered_basic_blocks,--dfs_num) = bb;
+                        if (!on_reverse_cfg)
+                                bb->dfs_number = dfs_num;
+                }
         }
-        else 
-                bb = NULL;
 
-        return bb;
+        XDELETEVEC(stack_bb);
+        XDELETEVEC(stack_ei);
+        return ordered_basic_blocks;
 }
 
 int
@@ -1122,95 +1381,2059 @@ report_dfa_spec_error(const char * mesg)
         exit(1);
 }
 
-/****************** dfvalue interface  ********************/
-/* defined in terms of bitmap support available in gcc */
-/* please see the sbitmap.h and sbitmap.c files        */
+/****************** dfvalue kernels  ********************/
+
+/* The word loops behind the dfvalue interface. They work on the words
+   of sbitmaps directly so that a set of kernels using the vector units
+   of the host can be chosen once by select_dfvalue_kernels. Vector
+   kernels (SSE2, AVX2 and AVX-512) are built only when this file is
+   compiled by a GCC for x86 which provides target attributes and
+   __builtin_cpu_supports; otherwise, and on hosts without these units,
+   the scalar kernels are used.
+
+   All kernels combine their operands with AND, OR and AND NOT only, so
+   the bits beyond n_bits in the last word, which sbitmap keeps clear,
+   remain clear. This is what allows equality to compare whole words.
+   The gen-kill kernel works on the words [first, n) of its operands,
+   so that a range of words can be solved on its own (see
+   meet_gen_kill_dfvalue_words_into).
+*/
 
-bool
-is_dfvalue_equal(dfvalue value1, dfvalue value2)
+#if GCC_VERSION >= 4009 && (defined (__i386__) || defined (__x86_64__))
+#define DFVALUE_VECTOR_KERNELS 1
+#else
+#define DFVALUE_VECTOR_KERNELS 0
+#endif
+
+#if DFVALUE_VECTOR_KERNELS && GCC_VERSION >= 5000
+#define DFVALUE_AVX512_KERNELS 1
+#else
+#define DFVALUE_AVX512_KERNELS 0
+#endif
+
+typedef SBITMAP_ELT_TYPE dfvalue_word;
+
+struct dfvalue_kernel_set
 {
-	return (sbitmap_equal(value1,value2));
-}
+        const char *name;
+        void (*a_and_b) (dfvalue_word *, const dfvalue_word *, 
+                         const dfvalue_word *, unsigned int);
+        void (*a_or_b) (dfvalue_word *, const dfvalue_word *, 
+                        const dfvalue_word *, unsigned int);
+        void (*union_of_diff) (dfvalue_word *, const dfvalue_word *, 
+                               const dfvalue_word *, const dfvalue_word *, unsigned int);
+        bool (*equal) (const dfvalue_word *, const dfvalue_word *, unsigned int);
+        bool (*meet_gen_kill) (dfvalue_word *, dfvalue *, int, bool, 
+                               const dfvalue_word *, const dfvalue_word *, 
+                               unsigned int, unsigned int);
+};
 
-void
-free_dfvalue_space(dfvalue value)
+static void
+a_and_b_scalar (dfvalue_word *dst, const dfvalue_word *a, const dfvalue_word *b, 
+                unsigned int n)
 {
-    sbitmap_free(value);
+        unsigned int i;
+
+        for (i = 0; i < n; i++)
+                dst[i] = a[i] & b[i];
 }
 
-dfvalue 
-intersect_dfvalues (dfvalue value1, dfvalue value2)
+static void
+a_or_b_scalar (dfvalue_word *dst, const dfvalue_word *a, const dfvalue_word *b, 
+               unsigned int n)
 {
-	sbitmap temp;
+        unsigned int i;
 
-        temp  = make_uninitialised_dfvalue();
+        for (i = 0; i < n; i++)
+                dst[i] = a[i] | b[i];
+}
 
-        sbitmap_a_and_b(temp, value1, value2);
-	
-	return temp;
+static void
+union_of_diff_scalar (dfvalue_word *dst, const dfvalue_word *a, const dfvalue_word *b, 
+                      const dfvalue_word *c, unsigned int n)
+{
+        unsigned int i;
+
+        for (i = 0; i < n; i++)
+                dst[i] = a[i] | (b[i] & ~c[i]);
 }
 
-dfvalue 
-a_plus_b_minus_c(dfvalue v_a, dfvalue v_b, dfvalue v_c)
+static bool
+equal_scalar (const dfvalue_word *a, const dfvalue_word *b, unsigned int n)
 {
-	sbitmap temp;
+        unsigned int i;
 
-        temp  = make_uninitialised_dfvalue();
+        for (i = 0; i < n; i++)
+                if (a[i] != b[i])
+                        return false;
+        return true;
+}
 
-        sbitmap_union_of_diff(temp, v_a, v_b, v_c);
-	
-	return temp;
+static bool
+meet_gen_kill_scalar (dfvalue_word *dst, dfvalue *values, int count, bool intersect,
+                      const dfvalue_word *gen, const dfvalue_word *kill, 
+                      unsigned int first, unsigned int n)
+{
+        unsigned int i;
+        int j;
+        dfvalue_word word, changed = 0;
+
+        for (i = first; i < n; i++)
+        {
+                word = values[0]->words[i];
+                if (intersect)
+                        for (j = 1; j < count; j++)
+                                word &= values[j]->words[i];
+                else
+                        for (j = 1; j < count; j++)
+                                word |= values[j]->words[i];
+                if (kill)
+                        word &= ~kill[i];
+                if (gen)
+                        word |= gen[i];
+                changed |= dst[i] ^ word;
+                dst[i] = word;
+        }
+        return changed != 0;
 }
 
-dfvalue 
-union_dfvalues (dfvalue value1, dfvalue value2)
+static const struct dfvalue_kernel_set scalar_dfvalue_kernels =
 {
-	sbitmap temp;
+        "scalar", a_and_b_scalar, a_or_b_scalar, union_of_diff_scalar, 
+        equal_scalar, meet_gen_kill_scalar
+};
 
-        temp  = make_uninitialised_dfvalue();
+#if DFVALUE_VECTOR_KERNELS
 
-        sbitmap_a_or_b(temp, value1, value2);
-	
-	return temp;
+/* Defines the kernel set ISA##_dfvalue_kernels working on vectors of
+   BYTES bytes, compiled for TARGET. Words left over after the last
+   whole vector are handled one at a time. The vector type only needs
+   the alignment of a word since sbitmap words are not aligned any
+   further.
+*/
+
+#define DFVALUE_VECTOR(ISA, P) (*(dfvalue_vector_##ISA *) (P))
+#define DFVALUE_CONST_VECTOR(ISA, P) (*(const dfvalue_vector_##ISA *) (P))
+
+#define DEFINE_DFVALUE_KERNELS(ISA, TARGET, BYTES)                              \
+typedef dfvalue_word dfvalue_vector_##ISA                                       \
+  __attribute__ ((vector_size (BYTES), aligned (sizeof (dfvalue_word)), may_alias)); \
+                                                                                \
+static void __attribute__ ((target (TARGET)))                                   \
+a_and_b_##ISA (dfvalue_word *dst, const dfvalue_word *a, const dfvalue_word *b, \
+               unsigned int n)                                                  \
+{                                                                               \
+        const unsigned int step = BYTES / sizeof (dfvalue_word);                \
+        unsigned int i = 0;                                                     \
+                                                                                \
+        for (; i + step <= n; i += step)                                        \
+                DFVALUE_VECTOR (ISA, dst + i) = DFVALUE_CONST_VECTOR (ISA, a + i) \
+                                              & DFVALUE_CONST_VECTOR (ISA, b + i); \
+        for (; i < n; i++)                                                      \
+                dst[i] = a[i] & b[i];                                           \
+}                                                                               \
+                                                                                \
+static void __attribute__ ((target (TARGET)))                                   \
+a_or_b_##ISA (dfvalue_word *dst, const dfvalue_word *a, const dfvalue_word *b,  \
+              unsigned int n)                                                   \
+{                                                                               \
+        const unsigned int step = BYTES / sizeof (dfvalue_word);                \
+        unsigned int i = 0;                                                     \
+                                                                                \
+        for (; i + step <= n; i += step)                                        \
+                DFVALUE_VECTOR (ISA, dst + i) = DFVALUE_CONST_VECTOR (ISA, a + i) \
+                                              | DFVALUE_CONST_VECTOR (ISA, b + i); \
+        for (; i < n; i++)                                                      \
+                dst[i] = a[i] | b[i];                                           \
+}                                                                               \
+                                                                                \
+static void __attribute__ ((target (TARGET)))                                   \
+union_of_diff_##ISA (dfvalue_word *dst, const dfvalue_word *a,                  \
+                     const dfvalue_word *b, const dfvalue_word *c,              \
+                     unsigned int n)                                            \
+{                                                                               \
+        const unsigned int step = BYTES / sizeof (dfvalue_word);                \
+        unsigned int i = 0;                                                     \
+                                                                                \
+        for (; i + step <= n; i += step)                                        \
+                DFVALUE_VECTOR (ISA, dst + i) = DFVALUE_CONST_VECTOR (ISA, a + i) \
+                                              | (DFVALUE_CONST_VECTOR (ISA, b + i) \
+                                                 & ~DFVALUE_CONST_VECTOR (ISA, c + i)); \
+        for (; i < n; i++)                                                      \
+                dst[i] = a[i] | (b[i] & ~c[i]);                                 \
+}                                                                               \
+                                                                                \
+static bool __attribute__ ((target (TARGET)))                                   \
+equal_##ISA (const dfvalue_word *a, const dfvalue_word *b, unsigned int n)      \
+{                                                                               \
+        const unsigned int step = BYTES / sizeof (dfvalue_word);                \
+        unsigned int i = 0, k;                                                  \
+        dfvalue_vector_##ISA difference;                                        \
+        dfvalue_word any = 0;                                                   \
+                                                                                \
+        for (; i + step <= n; i += step)                                        \
+        {                                                                       \
+                difference = DFVALUE_CONST_VECTOR (ISA, a + i)                  \
+                             ^ DFVALUE_CONST_VECTOR (ISA, b + i);               \
+                for (k = 0; k < step; k++)                                      \
+                        any |= difference[k];                                   \
+                if (any)                                                        \
+                        return false;                                           \
+        }                                                                       \
+        for (; i < n; i++)                                                      \
+                any |= a[i] ^ b[i];                                             \
+        return any == 0;                                                        \
+}                                                                               \
+                                                                                \
+static bool __attribute__ ((target (TARGET)))                                   \
+meet_gen_kill_##ISA (dfvalue_word *dst, dfvalue *values, int count,            \
+                     bool intersect, const dfvalue_word *gen,                   \
+                     const dfvalue_word *kill, unsigned int first,              \
+                     unsigned int n)                                            \
+{                                                                               \
+        const unsigned int step = BYTES / sizeof (dfvalue_word);                \
+        unsigned int i = first, k;                                              \
+        int j;                                                                  \
+        dfvalue_vector_##ISA vector, changed_vector = { 0 };                    \
+        dfvalue_word word, changed = 0;                                         \
+                                                                                \
+        for (; i + step <= n; i += step)                                        \
+        {                                                                       \
+                vector = DFVALUE_CONST_VECTOR (ISA, values[0]->words + i);      \
+                if (intersect)                                                  \
+                        for (j = 1; j < count; j++)                             \
+                                vector &= DFVALUE_CONST_VECTOR (ISA, values[j]->words + i); \
+                else                                                            \
+                        for (j = 1; j < count; j++)                             \
+                                vector |= DFVALUE_CONST_VECTOR (ISA, values[j]->words + i); \
+                if (kill)                                                       \
+                        vector &= ~DFVALUE_CONST_VECTOR (ISA, kill + i);        \
+                if (gen)                                                        \
+                        vector |= DFVALUE_CONST_VECTOR (ISA, gen + i);          \
+                changed_vector |= DFVALUE_CONST_VECTOR (ISA, dst + i) ^ vector; \
+                DFVALUE_VECTOR (ISA, dst + i) = vector;                         \
+        }                                                                       \
+        for (k = 0; k < step; k++)                                              \
+                changed |= changed_vector[k];                                   \
+        for (; i < n; i++)                                                      \
+        {                                                                       \
+                word = values[0]->words[i];                                     \
+                for (j = 1; j < count; j++)                                     \
+                        word = intersect ? word & values[j]->words[i]           \
+                                         : word | values[j]->words[i];          \
+                if (kill)                                                       \
+                        word &= ~kill[i];                                       \
+                if (gen)                                                        \
+                        word |= gen[i];                                         \
+                changed |= dst[i] ^ word;                                       \
+                dst[i] = word;                                                  \
+        }                                                                       \
+        return changed != 0;                                                    \
+}                                                                               \
+                                                                                \
+static const struct dfvalue_kernel_set ISA##_dfvalue_kernels =                  \
+{                                                                               \
+        #ISA, a_and_b_##ISA, a_or_b_##ISA, union_of_diff_##ISA,                 \
+        equal_##ISA, meet_gen_kill_##ISA                                        \
+};
+
+DEFINE_DFVALUE_KERNELS (sse2, "sse2", 16)
+DEFINE_DFVALUE_KERNELS (avx2, "avx2", 32)
+#if DFVALUE_AVX512_KERNELS
+DEFINE_DFVALUE_KERNELS (avx512, "avx512f", 64)
+#endif
+
+#endif /* DFVALUE_VECTOR_KERNELS */
+
+static const struct dfvalue_kernel_set *dfvalue_kernels = &scalar_dfvalue_kernels;
+
+/* Below this many words the set up of the vector loops costs more than
+   it saves, so short dfvalues always use the scalar kernels. */
+#define DFVALUE_VECTOR_MIN_WORDS 8
+
+#define DFVALUE_KERNELS_FOR(VALUE) \
+  ((VALUE)->size < DFVALUE_VECTOR_MIN_WORDS ? &scalar_dfvalue_kernels : dfvalue_kernels)
+
+/* Chooses the widest kernel set supported by the host CPU. This is
+   done once, before the first analysis; until then the scalar kernels
+   are used.
+*/
+
+static void
+select_dfvalue_kernels (void)
+{
+        static bool selected = false;
+
+        if (selected)
+                return;
+        selected = true;
+
+#if DFVALUE_VECTOR_KERNELS
+        __builtin_cpu_init ();
+#if DFVALUE_AVX512_KERNELS
+        if (__builtin_cpu_supports ("avx512f"))
+        {
+                dfvalue_kernels = &avx512_dfvalue_kernels;
+                return;
+        }
+#endif
+        if (__builtin_cpu_supports ("avx2"))
+                dfvalue_kernels = &avx2_dfvalue_kernels;
+        else if (__builtin_cpu_supports ("sse2"))
+                dfvalue_kernels = &sse2_dfvalue_kernels;
+#endif
 }
 
-dfvalue
-make_initialised_dfvalue(initial_value value)
+#if BENCHMARK_DFVALUE_KERNELS
+
+/* Microbenchmark of the kernel sets available on the host, enabled by
+   compiling this file with -DBENCHMARK_DFVALUE_KERNELS=1. For random
+   dfvalues of 64, 1k, 16k and 256k bits it times the gen-kill transfer
+   followed by the equality test, which is what a basic block visit
+   does, and prints the time of each kernel set and its speedup over
+   the scalar kernels.
+*/
+
+static void
+benchmark_dfvalue_kernels (FILE *file)
 {
-        sbitmap temp;
+        static const unsigned int widths[] = { 64, 1024, 16384, 262144 };
+        const struct dfvalue_kernel_set *sets[4];
+        int set_count = 0, iter, set;
+        unsigned int width, bit, repetition, repetitions, seed = 12345;
+        sbitmap gen, in, kill, out;
+        long start, elapsed, scalar_time = 0;
+        bool equal = false;
+
+        sets[set_count++] = &scalar_dfvalue_kernels;
+#if DFVALUE_VECTOR_KERNELS
+        __builtin_cpu_init ();
+        if (__builtin_cpu_supports ("sse2"))
+                sets[set_count++] = &sse2_dfvalue_kernels;
+        if (__builtin_cpu_supports ("avx2"))
+                sets[set_count++] = &avx2_dfvalue_kernels;
+#if DFVALUE_AVX512_KERNELS
+        if (__builtin_cpu_supports ("avx512f"))
+                sets[set_count++] = &avx512_dfvalue_kernels;
+#endif
+#endif
 
-        temp = make_uninitialised_dfvalue();
+        fprintf(file, "\n%10s %8s %12s %8s\n", "bits", "kernels", "time (us)", "speedup");
+        for (iter = 0; iter < (int) ARRAY_SIZE (widths); iter++)
+        {
+                width = widths[iter];
+                repetitions = MAX (1, (1u << 30) / width);
+
+                gen = sbitmap_alloc(width);
+                in = sbitmap_alloc(width);
+                kill = sbitmap_alloc(width);
+                out = sbitmap_alloc(width);
+                sbitmap_zero(gen);
+                sbitmap_zero(in);
+                sbitmap_zero(kill);
+                sbitmap_zero(out);
+                for (bit = 0; bit < width; bit++)
+                {
+                        seed = seed * 1103515245 + 12345;
+                        if (seed & 0x10000)
+                                SET_BIT(gen, bit);
+                        if (seed & 0x20000)
+                                SET_BIT(in, bit);
+                        if (seed & 0x40000)
+                                SET_BIT(kill, bit);
+                }
 
-        switch (value)
-        {        
-                case ONES:
-                        sbitmap_ones(temp);
-                        break;
-                case ZEROS:
-                        sbitmap_zero(temp);
-                        break;
-                default:
-                        report_dfa_spec_error ("Wrong initial value (Function make_initialised_dfvalue)");
-                        break;
+                for (set = 0; set < set_count; set++)
+                {
+                        start = get_run_time ();
+                        for (repetition = 0; repetition < repetitions; repetition++)
+                        {
+                                sets[set]->union_of_diff (out->elms, gen->elms, in->elms, 
+                                                          kill->elms, out->size);
+                                equal ^= sets[set]->equal (out->elms, in->elms, out->size);
+                        }
+                        elapsed = get_run_time () - start;
+                        if (set == 0)
+                                scalar_time = elapsed;
+                        fprintf(file, "%10u %8s %12ld %8.2f\n", width, sets[set]->name, elapsed,
+                                elapsed ? (double) scalar_time / elapsed : 0.0);
+                }
+
+                sbitmap_free(gen);
+                sbitmap_free(in);
+                sbitmap_free(kill);
+                sbitmap_free(out);
         }
-        return temp;
+        fprintf(file, "(checksum %d)\n", (int) equal);
 }
 
+#endif /* BENCHMARK_DFVALUE_KERNELS */
+
+/****************** dfvalue interface  ********************/
+/* defined in terms of bitmap support available in gcc */
+/* please see the sbitmap.h, sbitmap.c, bitmap.h and    */
+/* bitmap.c files                                       */
+/* the word loops are the dfvalue kernels above         */
+
+/* See create_dfvalue_pool */
+static alloc_pool dfvalue_pool = NULL;
+static dfvalue_form dfvalue_pool_form = DENSE_DFVALUE;
+static bitmap_obstack dfvalue_bitmap_obstack;
+static alloc_pool dfvalue_word_pool = NULL;
+
+/* Small dfvalues of the current analysis (see create_dfvalue_pool):
+   they are carved out of small_dfvalue_obstack above small_dfvalue_mark,
+   and those freed are chained through their words field on
+   small_dfvalue_free_list. small_dfvalue_mark is NULL outside an
+   analysis over a small universe. */
+static struct obstack small_dfvalue_obstack;
+static bool small_dfvalue_obstack_initialised = false;
+static char *small_dfvalue_mark = NULL;
+static dfvalue small_dfvalue_free_list = NULL;
+
+/* Results of operations on adaptive dfvalues in each form, and the
+   number of times an adaptive dfvalue changed its form, during the
+   current analysis (see dump_dfvalue_statistics). They are summed over
+   all the pools the analysis creates, and adaptive_dfvalues_used is
+   set if any of those pools holds adaptive dfvalues. */
+static unsigned long dfvalue_form_results[ADAPTIVE_DFVALUE];
+static unsigned long dfvalue_form_changes = 0;
+static bool adaptive_dfvalues_used = false;
+
 extern int relevant_pfbv_entity_count;
 
-dfvalue
-make_uninitialised_dfvalue(void)
-{        
-        sbitmap temp;
-        
-        temp = sbitmap_alloc(relevant_pfbv_entity_count);
+#define DFVALUE_WORDS(VALUE) ((VALUE)->words)
+#define DFVALUE_HEADER_SIZE offsetof (struct dfvalue_def, elms)
+#define DFVALUE_SMALL_SIZE offsetof (struct dfvalue_def, run_count)
+#define DFVALUE_WORD_COUNT MAX (SBITMAP_SET_SIZE (relevant_pfbv_entity_count), 1)
+#define DFVALUE_SMALL_UNIVERSE_P(N_BITS) (SBITMAP_SET_SIZE (N_BITS) <= DFVALUE_SMALL_WORDS)
+#define DFVALUE_SMALL_P(VALUE) ((VALUE)->small)
+#define DFVALUE_PLAIN_DENSE_P(VALUE) ((VALUE)->form == DENSE_DFVALUE && !(VALUE)->adaptive)
+#define DFVALUE_FORGET_SPAN(VALUE) \
+  ((VALUE)->span_start = 0, (VALUE)->span_end = (VALUE)->size)
+#define DFVALUE_WORD_BIT(INDEX) ((SBITMAP_ELT_TYPE) 1 << (INDEX) % SBITMAP_ELT_BITS)
+#define DFVALUE_WORD_BIT_P(WORDS, INDEX) \
+  (((WORDS)[(INDEX) / SBITMAP_ELT_BITS] & DFVALUE_WORD_BIT (INDEX)) != 0)
+
+/* Visits in increasing order every member INDEX of the dense form of
+   VALUE, skipping words without members */
+#define FOR_EACH_DENSE_DFVALUE_MEMBER(VALUE, WORD, INDEX)                       \
+  for ((WORD) = 0; (WORD) < (VALUE)->size; (WORD)++)                      \
+    if ((VALUE)->words[WORD] != 0)                                              \
+      for ((INDEX) = (WORD) * SBITMAP_ELT_BITS;                                 \
+           (INDEX) < ((WORD) + 1) * SBITMAP_ELT_BITS; (INDEX)++)                \
+        if (DFVALUE_WORD_BIT_P ((VALUE)->words, INDEX))
+
+#if GCC_VERSION >= 3004
+#define dfvalue_word_popcount(WORD) ((unsigned int) __builtin_popcountll (WORD))
+#else
+static unsigned int
+dfvalue_word_popcount (SBITMAP_ELT_TYPE word)
+{
+        unsigned int count = 0;
 
-        return temp;
+        for (; word; word &= word - 1)
+                count++;
+        return count;
+}
+#endif
+
+/* Bytes taken by a dfvalue of the given form over a universe of n_bits
+   entities, header included. A dense dfvalue of a small universe stops
+   after its small words; the dense words of adaptive dfvalues are kept
+   apart. */
+
+static size_t
+dfvalue_size_for (dfvalue_form form, unsigned int n_bits)
+{
+        if (form != DENSE_DFVALUE)
+                return sizeof (struct dfvalue_def);
+        if (DFVALUE_SMALL_UNIVERSE_P (n_bits))
+                return DFVALUE_SMALL_SIZE;
+        return DFVALUE_HEADER_SIZE + SBITMAP_SET_SIZE (n_bits) * sizeof (SBITMAP_ELT_TYPE);
 }
 
-void
-dump_dfvalue (FILE * file, dfvalue value)
+static size_t
+dfvalue_size (dfvalue_form form)
+{
+        return dfvalue_size_for (form, relevant_pfbv_entity_count);
+}
+
+/* Fills in the header of a dfvalue of the given form over a universe of
+   n_bits entities. The elements of its sparse form are taken from
+   obstack, and the dense words of an adaptive dfvalue from word_pool.
+   An adaptive dfvalue starts in the run form. Nothing past the small
+   words of a small dfvalue is touched. */
+
+static void
+initialise_dfvalue_header_for (dfvalue value, dfvalue_form form, unsigned int n_bits,
+                               bitmap_obstack *obstack, alloc_pool word_pool, bool pooled)
+{
+        value->pooled = pooled;
+        value->adaptive = (form == ADAPTIVE_DFVALUE);
+        value->form = value->adaptive ? RUN_DFVALUE : form;
+        value->small = (form == DENSE_DFVALUE && DFVALUE_SMALL_UNIVERSE_P (n_bits));
+        value->n_bits = n_bits;
+        value->size = SBITMAP_SET_SIZE (n_bits);
+        DFVALUE_FORGET_SPAN (value);
+        if (value->small)
+        {
+                value->words = value->small_words;
+                memset (value->small_words, 0, sizeof (value->small_words));
+                return;
+        }
+        value->run_count = 0;
+        value->words = (form == DENSE_DFVALUE) ? value->elms : NULL;
+        value->word_pool = word_pool;
+        bitmap_initialize (&value->sparse, obstack);
+}
+
+static void
+initialise_dfvalue_header (dfvalue value, dfvalue_form form, bitmap_obstack *obstack,
+                           alloc_pool word_pool, bool pooled)
 {
-	dump_sbitmap(file, value);
+        initialise_dfvalue_header_for (value, form, relevant_pfbv_entity_count,
+                                       obstack, word_pool, pooled);
 }
 
+static dfvalue
+make_dfvalue_of_form (dfvalue_form form)
+{
+        dfvalue temp;
+
+        if (small_dfvalue_mark && form == DENSE_DFVALUE)
+        {
+                temp = small_dfvalue_free_list;
+                if (temp)
+                        small_dfvalue_free_list = (dfvalue) temp->words;
+                else
+                        temp = (dfvalue) obstack_alloc (&small_dfvalue_obstack, DFVALUE_SMALL_SIZE);
+                initialise_dfvalue_header (temp, form, NULL, NULL, true);
+        }
+        else if (dfvalue_pool && form == dfvalue_pool_form)
+        {
+                temp = (dfvalue) pool_alloc(dfvalue_pool);
+                initialise_dfvalue_header (temp, form, &dfvalue_bitmap_obstack, 
+                                           dfvalue_word_pool, true);
+        }
+        else
+        {
+                temp = (dfvalue) XNEWVAR (struct dfvalue_def, dfvalue_size (form));
+                initialise_dfvalue_header (temp, form, &bitmap_default_obstack, NULL, false);
+        }
+        return temp;
+}
+
+/****************** dfvalue forms  ********************/
+
+/* Sets the bits start to end - 1 of words */
+
+static void
+set_word_range (SBITMAP_ELT_TYPE *words, unsigned int start, unsigned int end)
+{
+        for (; start < end && start % SBITMAP_ELT_BITS; start++)
+                words[start / SBITMAP_ELT_BITS] |= DFVALUE_WORD_BIT (start);
+        for (; start + SBITMAP_ELT_BITS <= end; start += SBITMAP_ELT_BITS)
+                words[start / SBITMAP_ELT_BITS] = ~(SBITMAP_ELT_TYPE) 0;
+        for (; start < end; start++)
+                words[start / SBITMAP_ELT_BITS] |= DFVALUE_WORD_BIT (start);
+}
+
+/* Writes the members of value, in any form, into dense words */
+
+static void
+fill_words_from_dfvalue (SBITMAP_ELT_TYPE *words, dfvalue value)
+{
+        unsigned int i;
+        bitmap_iterator bi;
+
+        if (value->form == DENSE_DFVALUE)
+        {
+                memcpy (words, value->words, value->size * sizeof (SBITMAP_ELT_TYPE));
+                return;
+        }
+
+        memset (words, 0, value->size * sizeof (SBITMAP_ELT_TYPE));
+        if (value->form == SPARSE_DFVALUE)
+        {
+                EXECUTE_IF_SET_IN_BITMAP (&value->sparse, 0, i, bi)
+                        words[i / SBITMAP_ELT_BITS] |= DFVALUE_WORD_BIT (i);
+        }
+        else
+                for (i = 0; i < value->run_count; i++)
+                        set_word_range (words, value->runs[2 * i], value->runs[2 * i + 1]);
+}
+
+/* Writes the members of value, in any form, into a GCC bitmap */
+
+static void
+fill_bitmap_from_dfvalue (bitmap head, dfvalue value)
+{
+        unsigned int word, i, j;
+
+        if (value->form == SPARSE_DFVALUE)
+        {
+                bitmap_copy (head, &value->sparse);
+                return;
+        }
+
+        bitmap_clear (head);
+        if (value->form == DENSE_DFVALUE)
+        {
+                FOR_EACH_DENSE_DFVALUE_MEMBER (value, word, i)
+                        bitmap_set_bit (head, i);
+        }
+        else
+                for (i = 0; i < value->run_count; i++)
+                        for (j = value->runs[2 * i]; j < value->runs[2 * i + 1]; j++)
+                                bitmap_set_bit (head, j);
+}
+
+/* Writes the runs of the members of value, in any form, into runs and
+   returns their number. Only the first DFVALUE_MAX_RUNS runs are
+   written; the count stops at DFVALUE_MAX_RUNS + 1. */
+
+static unsigned int
+fill_runs_from_dfvalue (unsigned int *runs, dfvalue value)
+{
+        unsigned int word, i, count = 0;
+        bitmap_iterator bi;
+
+        if (value->form == RUN_DFVALUE)
+        {
+                memcpy (runs, value->runs, 2 * value->run_count * sizeof (unsigned int));
+                return value->run_count;
+        }
+
+#define ADD_MEMBER_TO_RUNS(INDEX)                                               \
+        do {                                                                    \
+                if (count > 0 && runs[2 * count - 1] == (INDEX))                \
+                        runs[2 * count - 1]++;                                  \
+                else if (count == DFVALUE_MAX_RUNS)                             \
+                        return count + 1;                                       \
+                else                                                            \
+                {                                                               \
+                        runs[2 * count] = (INDEX);                              \
+                        runs[2 * count + 1] = (INDEX) + 1;                      \
+                        count++;                                                \
+                }                                                               \
+        } while (0)
+
+        if (value->form == DENSE_DFVALUE)
+        {
+                FOR_EACH_DENSE_DFVALUE_MEMBER (value, word, i)
+                        ADD_MEMBER_TO_RUNS (i);
+        }
+        else
+        {
+                EXECUTE_IF_SET_IN_BITMAP (&value->sparse, 0, i, bi)
+                        ADD_MEMBER_TO_RUNS (i);
+        }
+#undef ADD_MEMBER_TO_RUNS
+
+        return count;
+}
+
+/* Counts the members of value and the runs they make */
+
+static void
+count_dfvalue_members (dfvalue value, unsigned int *members, unsigned int *run_count)
+{
+        SBITMAP_ELT_TYPE word, carry = 0;
+        unsigned int i, last = 0;
+        bitmap_iterator bi;
+
+        *members = *run_count = 0;
+        switch (value->form)
+        {
+                case DENSE_DFVALUE:
+                        /* A run starts at every member whose predecessor is
+                           not a member */
+                        for (i = 0; i < value->size; i++)
+                        {
+                                word = value->words[i];
+                                *members += dfvalue_word_popcount (word);
+                                *run_count += dfvalue_word_popcount (word & ~((word << 1) | carry));
+                                carry = word >> (SBITMAP_ELT_BITS - 1);
+                        }
+                        break;
+                case SPARSE_DFVALUE:
+                        EXECUTE_IF_SET_IN_BITMAP (&value->sparse, 0, i, bi)
+                        {
+                                if (*members == 0 || i != last + 1)
+                                        (*run_count)++;
+                                (*members)++;
+                                last = i;
+                        }
+                        break;
+                default:
+                        for (i = 0; i < value->run_count; i++)
+                                *members += value->runs[2 * i + 1] - value->runs[2 * i];
+                        *run_count = value->run_count;
+                        break;
+        }
+}
+
+/* Releases what a dfvalue keeps for its current form. reform_dfvalue
+   then gives an adaptive dfvalue the empty storage of another form. */
+
+static void
+release_dfvalue_storage (dfvalue value)
+{
+        if (DFVALUE_SMALL_P (value))
+                return;
+        if (value->form == SPARSE_DFVALUE)
+                bitmap_clear (&value->sparse);
+        else if (value->form == DENSE_DFVALUE && value->adaptive)
+        {
+                pool_free (value->word_pool, value->words);
+                value->words = NULL;
+        }
+        value->run_count = 0;
+}
+
+static void
+reform_dfvalue (dfvalue value, dfvalue_form form)
+{
+        if (value->form == form)
+                return;
+
+        release_dfvalue_storage (value);
+        value->form = form;
+        if (form == DENSE_DFVALUE)
+                value->words = (SBITMAP_ELT_TYPE *) pool_alloc (value->word_pool);
+        dfvalue_form_changes++;
+}
+
+/* Moves an adaptive dfvalue into form, keeping its members. The storage
+   of each form is separate, so the members are written into the new
+   form before the old one is released. The run form must be able to
+   hold them. */
+
+static void
+convert_dfvalue (dfvalue value, dfvalue_form form)
+{
+        SBITMAP_ELT_TYPE *words;
+        unsigned int run_count;
+
+        if (value->form == form)
+                return;
+
+        switch (form)
+        {
+                case DENSE_DFVALUE:
+                        words = (SBITMAP_ELT_TYPE *) pool_alloc (value->word_pool);
+                        fill_words_from_dfvalue (words, value);
+                        release_dfvalue_storage (value);
+                        value->words = words;
+                        break;
+                case SPARSE_DFVALUE:
+                        fill_bitmap_from_dfvalue (&value->sparse, value);
+                        release_dfvalue_storage (value);
+                        break;
+                default:
+                        run_count = fill_runs_from_dfvalue (value->runs, value);
+                        if (run_count > DFVALUE_MAX_RUNS)
+                                report_dfa_spec_error ("Too many runs (Function convert_dfvalue)");
+                        release_dfvalue_storage (value);
+                        value->run_count = run_count;
+                        break;
+        }
+        value->form = form;
+        dfvalue_form_changes++;
+}
+
+/* Moves an adaptive dfvalue into the form that suits its members: the
+   run form when they make at most DFVALUE_MAX_RUNS runs, the sparse form
+   when fewer than one entity in DFVALUE_SPARSE_DENSITY is a member, and
+   the dense form otherwise. A member costs the sparse form up to an
+   element of about 40 bytes, where 256 entities cost the dense form 32
+   bytes.
+*/
+
+#define DFVALUE_SPARSE_DENSITY 256
+
+static void
+adapt_dfvalue (dfvalue value)
+{
+        unsigned int members, run_count;
+        dfvalue_form form;
+
+        if (!value->adaptive)
+                return;
+
+        count_dfvalue_members (value, &members, &run_count);
+        if (run_count <= DFVALUE_MAX_RUNS)
+                form = RUN_DFVALUE;
+        else if (members * DFVALUE_SPARSE_DENSITY < value->n_bits)
+                form = SPARSE_DFVALUE;
+        else
+                form = DENSE_DFVALUE;
+
+        convert_dfvalue (value, form);
+        dfvalue_form_results[form - 1]++;
+}
+
+/* Moves an adaptive dfvalue out of the run form when it needs more runs,
+   into the sparse or dense form as adapt_dfvalue would. */
+
+static void
+spill_dfvalue_runs (dfvalue value)
+{
+        unsigned int members, run_count;
+
+        count_dfvalue_members (value, &members, &run_count);
+        if (members * DFVALUE_SPARSE_DENSITY < value->n_bits)
+                convert_dfvalue (value, SPARSE_DFVALUE);
+        else
+                convert_dfvalue (value, DENSE_DFVALUE);
+}
+
+/* The denser of two forms: dense before sparse before runs */
+
+static dfvalue_form
+denser_dfvalue_form (dfvalue_form form1, dfvalue_form form2)
+{
+        if (form1 == DENSE_DFVALUE || form2 == DENSE_DFVALUE)
+                return DENSE_DFVALUE;
+        if (form1 == SPARSE_DFVALUE || form2 == SPARSE_DFVALUE)
+                return SPARSE_DFVALUE;
+        return RUN_DFVALUE;
+}
+
+/* The operations below are carried out in one form: the words of dense
+   dfvalues go through the kernels, sparse dfvalues through the bitmap
+   operations, and runs are merged directly. A plain dfvalue keeps its
+   form, and operands in another form are converted into temporaries
+   first; the driver uses a single representation during an analysis,
+   so this only happens when the flow functions of one analysis read
+   the results of another one. An adaptive dfvalue takes the densest
+   form among its operands, so that operands in the run form, which
+   plain dfvalues cannot take, need no conversion, and then adapts to
+   the result.
+*/
+
+typedef enum dfvalue_operation
+                {
+                        DFVALUE_AND=1,
+                        DFVALUE_OR,
+                        DFVALUE_UNION_OF_DIFF
+                } dfvalue_operation;
+
+static dfvalue
+dfvalue_in_form (dfvalue value, dfvalue_form form)
+{
+        dfvalue temp;
+
+        if (value == NULL || value->form == form)
+                return value;
+
+        temp = make_dfvalue_of_form (form);
+        copy_dfvalue_into (temp, value);
+        return temp;
+}
+
+static void
+release_dfvalue_in_form (dfvalue temp, dfvalue value)
+{
+        if (temp != value)
+                free_dfvalue_space (temp);
+}
+
+static bool
+run_member_p (dfvalue value, unsigned int index)
+{
+        unsigned int i;
+
+        if (value == NULL)
+                return false;
+        for (i = 0; i < value->run_count; i++)
+                if (value->runs[2 * i] <= index && index < value->runs[2 * i + 1])
+                        return true;
+        return false;
+}
+
+/* Computes the operation on operands in the run form, a NULL operand
+   standing for the empty set, by evaluating it between consecutive run
+   boundaries. Returns false, leaving dest alone, if the result needs
+   more than DFVALUE_MAX_RUNS runs. */
+
+static bool
+combine_dfvalue_runs (dfvalue dest, dfvalue_operation operation,
+                      dfvalue a, dfvalue b, dfvalue c)
+{
+        unsigned int bounds[6 * DFVALUE_MAX_RUNS], runs[2 * DFVALUE_MAX_RUNS];
+        unsigned int bound_count = 0, count = 0, i, j, bound;
+        dfvalue operands[3];
+        bool in_a, in_b, member, in_run = false;
+
+        operands[0] = a;
+        operands[1] = b;
+        operands[2] = c;
+        for (i = 0; i < 3; i++)
+                if (operands[i])
+                        for (j = 0; j < 2 * operands[i]->run_count; j++)
+                        {
+                                /* Insertion into the sorted bounds */
+                                bound = operands[i]->runs[j];
+                                for (count = bound_count++; count > 0 && bounds[count - 1] > bound; count--)
+                                        bounds[count] = bounds[count - 1];
+                                bounds[count] = bound;
+                        }
+
+        count = 0;
+        for (i = 0; i < bound_count; i++)
+        {
+                if (i > 0 && bounds[i] == bounds[i - 1])
+                        continue;
+                in_a = run_member_p (a, bounds[i]);
+                in_b = run_member_p (b, bounds[i]);
+                switch (operation)
+                {
+                        case DFVALUE_AND:
+                                member = in_a && in_b;
+                                break;
+                        case DFVALUE_OR:
+                                member = in_a || in_b;
+                                break;
+                        default:
+                                member = in_a || (in_b && !run_member_p (c, bounds[i]));
+                                break;
+                }
+                if (member == in_run)
+                        continue;
+                if (count == 2 * DFVALUE_MAX_RUNS)
+                        return false;
+                runs[count++] = bounds[i];
+                in_run = member;
+        }
+
+        /* dest is none of the operands unless it is in the run form */
+        reform_dfvalue (dest, RUN_DFVALUE);
+        memcpy (dest->runs, runs, count * sizeof (unsigned int));
+        dest->run_count = count / 2;
+        return true;
+}
+
+/* dest = a + (b - c) over dense words. Outside the spans of a and c
+   this is b, so only the words in their spans go through the kernel;
+   the others are copied from b, or left alone when dest is b.
+*/
+
+static void
+union_of_diff_in_span (dfvalue dest, dfvalue a, dfvalue b, dfvalue c)
+{
+        unsigned int start = MIN (a->span_start, c->span_start);
+        unsigned int end = MAX (a->span_end, c->span_end);
+
+        if (start > end)
+                start = end;
+        if (dest != b)
+        {
+                memcpy (DFVALUE_WORDS (dest), DFVALUE_WORDS (b), start * sizeof (SBITMAP_ELT_TYPE));
+                memcpy (DFVALUE_WORDS (dest) + end, DFVALUE_WORDS (b) + end, 
+                        (dest->size - end) * sizeof (SBITMAP_ELT_TYPE));
+        }
+        if (start < end)
+                DFVALUE_KERNELS_FOR(dest)->union_of_diff(DFVALUE_WORDS (dest) + start, 
+                                                         DFVALUE_WORDS (a) + start, 
+                                                         DFVALUE_WORDS (b) + start, 
+                                                         DFVALUE_WORDS (c) + start, end - start);
+}
+
+static void
+combine_dfvalues (dfvalue dest, dfvalue_operation operation,
+                  dfvalue v_a, dfvalue v_b, dfvalue v_c)
+{
+        dfvalue_form form = dest->form;
+        dfvalue a, b, c;
+        bitmap_head temp;
+
+        DFVALUE_FORGET_SPAN (dest);
+
+        if (dest->adaptive)
+        {
+                form = denser_dfvalue_form (v_a->form, v_b->form);
+                if (v_c)
+                        form = denser_dfvalue_form (form, v_c->form);
+                if (form == RUN_DFVALUE && combine_dfvalue_runs (dest, operation, v_a, v_b, v_c))
+                {
+                        adapt_dfvalue (dest);
+                        return;
+                }
+                if (form == RUN_DFVALUE)
+                        form = DENSE_DFVALUE;
+
+                if (dest == v_a || dest == v_b || dest == v_c)
+                        convert_dfvalue (dest, form);
+                else
+                        reform_dfvalue (dest, form);
+        }
+
+        a = dfvalue_in_form (v_a, form);
+        b = dfvalue_in_form (v_b, form);
+        c = dfvalue_in_form (v_c, form);
+
+        if (form == DENSE_DFVALUE)
+                switch (operation)
+                {
+                        case DFVALUE_AND:
+                                DFVALUE_KERNELS_FOR(dest)->a_and_b(DFVALUE_WORDS (dest), DFVALUE_WORDS (a), 
+                                                                   DFVALUE_WORDS (b), dest->size);
+                                break;
+                        case DFVALUE_OR:
+                                DFVALUE_KERNELS_FOR(dest)->a_or_b(DFVALUE_WORDS (dest), DFVALUE_WORDS (a), 
+                                                                  DFVALUE_WORDS (b), dest->size);
+                                break;
+                        default:
+                                union_of_diff_in_span (dest, a, b, c);
+                                break;
+                }
+        /* GCC's bitmap operations may not write over an operand; the
+           _into variants, or a temporary, are used when dest is one. */
+        else if (operation == DFVALUE_AND && (dest == a || dest == b))
+                bitmap_and_into (&dest->sparse, dest == a ? &b->sparse : &a->sparse);
+        else if (operation == DFVALUE_AND)
+                bitmap_and (&dest->sparse, &a->sparse, &b->sparse);
+        else if (operation == DFVALUE_OR && (dest == a || dest == b))
+                bitmap_ior_into (&dest->sparse, dest == a ? &b->sparse : &a->sparse);
+        else if (operation == DFVALUE_OR)
+                bitmap_ior (&dest->sparse, &a->sparse, &b->sparse);
+        else if (dest == a || dest == b || dest == c)
+        {
+                bitmap_initialize (&temp, &bitmap_default_obstack);
+                bitmap_ior_and_compl (&temp, &a->sparse, &b->sparse, &c->sparse);
+                bitmap_copy (&dest->sparse, &temp);
+                bitmap_clear (&temp);
+        }
+        else
+                bitmap_ior_and_compl (&dest->sparse, &a->sparse, &b->sparse, &c->sparse);
+
+        release_dfvalue_in_form (a, v_a);
+        release_dfvalue_in_form (b, v_b);
+        release_dfvalue_in_form (c, v_c);
+
+        adapt_dfvalue (dest);
+}
+
+/****************** dfvalue operations  ********************/
+
+bool
+is_dfvalue_equal(dfvalue value1, dfvalue value2)
+{
+        dfvalue_form form = denser_dfvalue_form (value1->form, value2->form);
+        dfvalue a, b;
+        bool equal;
+
+        if (DFVALUE_SMALL_P (value1) && DFVALUE_SMALL_P (value2))
+                return ((value1->small_words[0] ^ value2->small_words[0])
+                        | (value1->small_words[1] ^ value2->small_words[1])) == 0;
+
+        if (form == RUN_DFVALUE)
+                return value1->run_count == value2->run_count
+                       && memcmp (value1->runs, value2->runs, 
+                                  2 * value1->run_count * sizeof (unsigned int)) == 0;
+
+        a = dfvalue_in_form (value1, form);
+        b = dfvalue_in_form (value2, form);
+        if (form == DENSE_DFVALUE)
+                equal = DFVALUE_KERNELS_FOR(a)->equal(DFVALUE_WORDS (a), DFVALUE_WORDS (b), 
+                                                      a->size);
+        else
+                equal = bitmap_equal_p (&a->sparse, &b->sparse);
+
+        release_dfvalue_in_form (a, value1);
+        release_dfvalue_in_form (b, value2);
+	return equal;
+}
+
+void
+free_dfvalue_space(dfvalue value)
+{
+        release_dfvalue_storage (value);
+        if (value->pooled && DFVALUE_SMALL_P (value))
+        {
+                value->words = (SBITMAP_ELT_TYPE *) small_dfvalue_free_list;
+                small_dfvalue_free_list = value;
+        }
+        else if (value->pooled)
+                pool_free(dfvalue_pool, value);
+        else
+                XDELETE (value);
+}
+
+dfvalue 
+intersect_dfvalues (dfvalue value1, dfvalue value2)
+{
+	dfvalue temp;
+
+        temp  = make_uninitialised_dfvalue();
+
+        intersect_dfvalues_into(temp, value1, value2);
+	
+	return temp;
+}
+
+dfvalue 
+a_plus_b_minus_c(dfvalue v_a, dfvalue v_b, dfvalue v_c)
+{
+	dfvalue temp;
+
+        temp  = make_uninitialised_dfvalue();
+
+        a_plus_b_minus_c_into(temp, v_a, v_b, v_c);
+	
+	return temp;
+}
+
+dfvalue 
+copy_dfvalue (dfvalue value)
+{
+	dfvalue temp;
+
+        temp  = make_uninitialised_dfvalue();
+
+        copy_dfvalue_into(temp, value);
+	
+	return temp;
+}
+
+dfvalue 
+union_dfvalues (dfvalue value1, dfvalue value2)
+{
+	dfvalue temp;
+
+        temp  = make_uninitialised_dfvalue();
+
+        union_dfvalues_into(temp, value1, value2);
+	
+	return temp;
+}
+
+/* In place variants of the operations above. The result is written
+   into dest, which must already have been allocated and may be the
+   same dfvalue as one of the operands. These let the driver visit a
+   basic block without allocating anything. Small operands are combined
+   in place, both words at once.
+*/
+
+void
+intersect_dfvalues_into (dfvalue dest, dfvalue value1, dfvalue value2)
+{
+        if (DFVALUE_SMALL_P (dest) && DFVALUE_SMALL_P (value1) && DFVALUE_SMALL_P (value2))
+        {
+                dest->small_words[0] = value1->small_words[0] & value2->small_words[0];
+                dest->small_words[1] = value1->small_words[1] & value2->small_words[1];
+                return;
+        }
+        combine_dfvalues (dest, DFVALUE_AND, value1, value2, NULL);
+}
+
+void
+union_dfvalues_into (dfvalue dest, dfvalue value1, dfvalue value2)
+{
+        if (DFVALUE_SMALL_P (dest) && DFVALUE_SMALL_P (value1) && DFVALUE_SMALL_P (value2))
+        {
+                dest->small_words[0] = value1->small_words[0] | value2->small_words[0];
+                dest->small_words[1] = value1->small_words[1] | value2->small_words[1];
+                return;
+        }
+        combine_dfvalues (dest, DFVALUE_OR, value1, value2, NULL);
+}
+
+void
+a_plus_b_minus_c_into (dfvalue dest, dfvalue v_a, dfvalue v_b, dfvalue v_c)
+{
+        if (DFVALUE_SMALL_P (dest) && DFVALUE_SMALL_P (v_a) && DFVALUE_SMALL_P (v_b) 
+            && DFVALUE_SMALL_P (v_c))
+        {
+                dest->small_words[0] = v_a->small_words[0] 
+                                       | (v_b->small_words[0] & ~v_c->small_words[0]);
+                dest->small_words[1] = v_a->small_words[1] 
+                                       | (v_b->small_words[1] & ~v_c->small_words[1]);
+                return;
+        }
+        combine_dfvalues (dest, DFVALUE_UNION_OF_DIFF, v_a, v_b, v_c);
+}
+
+/* Copies value into dest, in the form of dest. An adaptive dest takes
+   the form of value first. */
+
+void
+copy_dfvalue_into (dfvalue dest, dfvalue value)
+{
+        if (dest == value)
+                return;
+
+        if (DFVALUE_SMALL_P (dest) && DFVALUE_SMALL_P (value))
+        {
+                dest->small_words[0] = value->small_words[0];
+                dest->small_words[1] = value->small_words[1];
+                return;
+        }
+
+        DFVALUE_FORGET_SPAN (dest);
+        if (dest->adaptive)
+                reform_dfvalue (dest, value->form);
+
+        switch (dest->form)
+        {
+                case DENSE_DFVALUE:
+                        fill_words_from_dfvalue (DFVALUE_WORDS (dest), value);
+                        break;
+                case SPARSE_DFVALUE:
+                        fill_bitmap_from_dfvalue (&dest->sparse, value);
+                        break;
+                default:
+                        memcpy (dest->runs, value->runs, sizeof (dest->runs));
+                        dest->run_count = value->run_count;
+                        break;
+        }
+
+        if (!value->adaptive)
+                adapt_dfvalue (dest);
+}
+
+/* Copies value into dest only if they differ, and reports whether
+   dest changed.
+*/
+
+bool
+update_dfvalue (dfvalue dest, dfvalue value)
+{
+        SBITMAP_ELT_TYPE changed;
+
+        DFVALUE_FORGET_SPAN (dest);
+        if (DFVALUE_SMALL_P (dest) && DFVALUE_SMALL_P (value))
+        {
+                changed = (dest->small_words[0] ^ value->small_words[0])
+                          | (dest->small_words[1] ^ value->small_words[1]);
+                dest->small_words[0] = value->small_words[0];
+                dest->small_words[1] = value->small_words[1];
+                return changed != 0;
+        }
+
+        if (is_dfvalue_equal(dest, value))
+                return false;
+        copy_dfvalue_into(dest, value);
+        return true;
+}
+
+/* Fused kernel of the gen-kill equations:
+
+        dest = gen + (MEET (values[0], ..., values[count-1]) - kill)
+
+   where MEET is the confluence, count is at least one, and a NULL gen
+   or kill stands for the empty set. All the operands are read in a
+   single pass over the words instead of one pass for every meet, the
+   transfer, and the comparison. Returns true if dest has changed.
+   There is no such pass over the other forms, or into an adaptive
+   dfvalue, which are computed one operation at a time instead.
+*/
+
+static bool
+meet_gen_kill_stepwise (dfvalue dest, dfvalue *values, int count,
+                        meet_operation confluence, dfvalue gen, dfvalue kill)
+{
+        dfvalue result, empty = NULL;
+        bool changed;
+        int j;
+
+        result = make_uninitialised_dfvalue ();
+        copy_dfvalue_into (result, values[0]);
+        for (j = 1; j < count; j++)
+                if (confluence == INTERSECTION)
+                        intersect_dfvalues_into (result, result, values[j]);
+                else
+                        union_dfvalues_into (result, result, values[j]);
+
+        if (kill)
+        {
+                if (!gen)
+                        gen = empty = make_initialised_dfvalue (ZEROS);
+                a_plus_b_minus_c_into (result, gen, result, kill);
+        }
+        else if (gen)
+                union_dfvalues_into (result, result, gen);
+
+        changed = update_dfvalue (dest, result);
+
+        free_dfvalue_space (result);
+        if (empty)
+                free_dfvalue_space (empty);
+        return changed;
+}
+
+/* The fused kernel over small dfvalues only, both words at once */
+
+static bool
+meet_gen_kill_small (dfvalue dest, dfvalue *values, int count, bool intersect,
+                     dfvalue gen, dfvalue kill)
+{
+        SBITMAP_ELT_TYPE word0 = values[0]->small_words[0];
+        SBITMAP_ELT_TYPE word1 = values[0]->small_words[1];
+        SBITMAP_ELT_TYPE changed;
+        int j;
+
+        if (intersect)
+                for (j = 1; j < count; j++)
+                {
+                        word0 &= values[j]->small_words[0];
+                        word1 &= values[j]->small_words[1];
+                }
+        else
+                for (j = 1; j < count; j++)
+                {
+                        word0 |= values[j]->small_words[0];
+                        word1 |= values[j]->small_words[1];
+                }
+        if (kill)
+        {
+                word0 &= ~kill->small_words[0];
+                word1 &= ~kill->small_words[1];
+        }
+        if (gen)
+        {
+                word0 |= gen->small_words[0];
+                word1 |= gen->small_words[1];
+        }
+        changed = (dest->small_words[0] ^ word0) | (dest->small_words[1] ^ word1);
+        dest->small_words[0] = word0;
+        dest->small_words[1] = word1;
+        return changed != 0;
+}
+
+bool
+meet_gen_kill_dfvalues_into (dfvalue dest, dfvalue *values, int count,
+                             meet_operation confluence, dfvalue gen, dfvalue kill)
+{
+        int j;
+
+        if (DFVALUE_SMALL_P (dest) && (!gen || DFVALUE_SMALL_P (gen))
+            && (!kill || DFVALUE_SMALL_P (kill)))
+        {
+                for (j = 0; j < count && DFVALUE_SMALL_P (values[j]); j++)
+                        ;
+                if (j == count)
+                        return meet_gen_kill_small (dest, values, count, 
+                                                    confluence == INTERSECTION, gen, kill);
+        }
+
+        DFVALUE_FORGET_SPAN (dest);
+        if (dest->form != DENSE_DFVALUE || dest->adaptive
+            || (gen && gen->form != DENSE_DFVALUE)
+            || (kill && kill->form != DENSE_DFVALUE))
+                return meet_gen_kill_stepwise (dest, values, count, confluence, gen, kill);
+        for (j = 0; j < count; j++)
+                if (values[j]->form != DENSE_DFVALUE)
+                        return meet_gen_kill_stepwise (dest, values, count, confluence, gen, kill);
+
+        return DFVALUE_KERNELS_FOR(dest)->meet_gen_kill(DFVALUE_WORDS (dest), values, count, 
+                                              confluence == INTERSECTION,
+                                              gen ? DFVALUE_WORDS (gen) : NULL,
+                                              kill ? DFVALUE_WORDS (kill) : NULL,
+                                              0, dest->size);
+}
+
+/* The fused kernel over the words [first, last) of plain dense
+   dfvalues. Nothing else of dest is written, not even its span, so
+   disjoint ranges of the same dfvalues may be computed at the same time
+   by different threads; dest must not have a narrowed span. GEN and
+   KILL whose spans miss the range are left out. Returns true if the
+   range of dest has changed.
+*/
+
+bool
+meet_gen_kill_dfvalue_words_into (dfvalue dest, dfvalue *values, int count,
+                                  meet_operation confluence, dfvalue gen, dfvalue kill,
+                                  unsigned int first, unsigned int last)
+{
+        const struct dfvalue_kernel_set *kernels = dfvalue_kernels;
+
+        if (gen && (gen->span_start >= gen->span_end 
+                    || gen->span_start >= last || gen->span_end <= first))
+                gen = NULL;
+        if (kill && (kill->span_start >= kill->span_end 
+                     || kill->span_start >= last || kill->span_end <= first))
+                kill = NULL;
+        if (last - first < DFVALUE_VECTOR_MIN_WORDS)
+                kernels = &scalar_dfvalue_kernels;
+
+        return kernels->meet_gen_kill(DFVALUE_WORDS (dest), values, count, 
+                                      confluence == INTERSECTION,
+                                      gen ? DFVALUE_WORDS (gen) : NULL,
+                                      kill ? DFVALUE_WORDS (kill) : NULL,
+                                      first, last);
+}
+
+/* The copy and the initialisation of dense dfvalues use memcpy and
+   memset, which are already vectorised by the C library.
+*/
+
+void
+initialise_dfvalue (dfvalue dest, initial_value value)
+{
+        int i;
+
+        if (value != ONES && value != ZEROS)
+        {
+                report_dfa_spec_error ("Wrong initial value (Function initialise_dfvalue)");
+                return;
+        }
+
+        DFVALUE_FORGET_SPAN (dest);
+        if (dest->adaptive)
+                reform_dfvalue (dest, RUN_DFVALUE);
+
+        switch (dest->form)
+        {        
+                case DENSE_DFVALUE:
+                        memset (DFVALUE_WORDS (dest), 0, dest->size * sizeof (SBITMAP_ELT_TYPE));
+                        if (value == ONES)
+                                set_word_range (DFVALUE_WORDS (dest), 0, dest->n_bits);
+                        break;
+                case SPARSE_DFVALUE:
+                        bitmap_clear (&dest->sparse);
+                        if (value == ONES)
+                                for (i = 0; i < relevant_pfbv_entity_count; i++)
+                                        bitmap_set_bit (&dest->sparse, i);
+                        break;
+                default:
+                        dest->run_count = 0;
+                        if (value == ONES && dest->n_bits > 0)
+                        {
+                                dest->runs[0] = 0;
+                                dest->runs[1] = dest->n_bits;
+                                dest->run_count = 1;
+                        }
+                        break;
+        }
+}
+
+dfvalue
+make_initialised_dfvalue(initial_value value)
+{
+        dfvalue temp;
+
+        temp = make_uninitialised_dfvalue();
+        initialise_dfvalue(temp, value);
+
+        return temp;
+}
+
+/* Makes a dfvalue with the representation of the current analysis, or
+   a dense one outside an analysis. */
+
+dfvalue
+make_uninitialised_dfvalue(void)
+{        
+        return make_dfvalue_of_form (dfvalue_pool ? dfvalue_pool_form : DENSE_DFVALUE);
+}
+
+/* Each gdfa_driver invocation allocates its dfvalues from a pool of
+   fixed-size slots for dfvalues of the representation its specification
+   asks for; the elements of sparse dfvalues come from an obstack of
+   the pool, and the dense words of adaptive dfvalues from a second
+   pool. Freeing a dfvalue returns its slot to the pool, and
+   free_dfvalue_pool releases all of them at once when the invocation
+   is over, including those that were never freed. The data flow
+   information returned by the driver is kept in slabs, which are not
+   part of the pool.
+
+   A small universe needs no pool: its small dfvalues are carved out of
+   an obstack that lives as long as the compiler, and recycled through
+   a free list, so an invocation only marks where its dfvalues start
+   and cuts the obstack back there when it is over.
+*/
+
+void
+create_dfvalue_pool(dfvalue_form form)
+{
+        if (DFVALUE_SMALL_UNIVERSE_P (relevant_pfbv_entity_count))
+        {
+                if (!small_dfvalue_obstack_initialised)
+                {
+                        gcc_obstack_init (&small_dfvalue_obstack);
+                        small_dfvalue_obstack_initialised = true;
+                }
+                small_dfvalue_mark = (char *) obstack_alloc (&small_dfvalue_obstack, 0);
+                small_dfvalue_free_list = NULL;
+                dfvalue_pool_form = DENSE_DFVALUE;
+                return;
+        }
+
+        dfvalue_pool_form = form;
+        if (form != DENSE_DFVALUE)
+                bitmap_obstack_initialize (&dfvalue_bitmap_obstack);
+        dfvalue_pool = create_alloc_pool("gdfa dfvalues", dfvalue_size (form), 64);
+        if (form == ADAPTIVE_DFVALUE)
+                dfvalue_word_pool = create_alloc_pool("gdfa dfvalue words", 
+                                                      DFVALUE_WORD_COUNT * sizeof (SBITMAP_ELT_TYPE), 
+                                                      64);
+        if (form == ADAPTIVE_DFVALUE)
+                adaptive_dfvalues_used = true;
+}
+
+void
+free_dfvalue_pool(void)
+{
+        if (small_dfvalue_mark)
+        {
+                obstack_free (&small_dfvalue_obstack, small_dfvalue_mark);
+                small_dfvalue_mark = NULL;
+                small_dfvalue_free_list = NULL;
+                return;
+        }
+
+        free_alloc_pool(dfvalue_pool);
+        dfvalue_pool = NULL;
+        if (dfvalue_word_pool)
+                free_alloc_pool(dfvalue_word_pool);
+        dfvalue_word_pool = NULL;
+        if (dfvalue_pool_form != DENSE_DFVALUE)
+                bitmap_obstack_release (&dfvalue_bitmap_obstack);
+        dfvalue_pool_form = DENSE_DFVALUE;
+}
+
+/* A slab holds count dfvalues laid out one after another in a single
+   allocation. Every row is a complete dfvalue, with the representation
+   of the current analysis. The words of dense rows start on a cache
+   line, except in small universes where the rows are small dfvalues
+   packed one after another; the elements of sparse rows come from an
+   obstack of the slab, and the dense words of adaptive rows from a pool
+   of the slab. The rest of the dfvalue interface works on the rows
+   unchanged. The rows belong to the slab and are released with it;
+   they must not be passed to free_dfvalue_space. Releasing a NULL slab
+   does nothing.
+*/
+
+#define DFVALUE_SLAB_ALIGNMENT 64
+
+struct dfvalue_slab_def
+{
+        char * memory;
+        char * rows;
+        size_t stride;
+        int count;
+        dfvalue_form form;
+        bitmap_obstack obstack;
+        alloc_pool word_pool;
+};
+
+dfvalue_slab
+make_dfvalue_slab (int count, initial_value value)
+{
+        dfvalue_slab slab;
+        size_t header_size = DFVALUE_HEADER_SIZE;
+        size_t mask;
+        int row;
+
+        slab = XNEW (struct dfvalue_slab_def);
+        slab->count = count;
+        slab->form = dfvalue_pool ? dfvalue_pool_form : DENSE_DFVALUE;
+        if (slab->form != DENSE_DFVALUE)
+                mask = 0;
+        else if (DFVALUE_SMALL_UNIVERSE_P (relevant_pfbv_entity_count))
+        {
+                header_size = 0;
+                mask = sizeof (SBITMAP_ELT_TYPE) - 1;
+        }
+        else
+                mask = DFVALUE_SLAB_ALIGNMENT - 1;
+        slab->stride = (dfvalue_size (slab->form) + mask) & ~mask;
+        slab->memory = XNEWVEC (char, slab->stride * MAX (count, 1) + header_size + mask);
+        slab->rows = (char *) (((size_t) slab->memory + header_size + mask) & ~mask) - header_size;
+        if (slab->form != DENSE_DFVALUE)
+                bitmap_obstack_initialize (&slab->obstack);
+        slab->word_pool = NULL;
+        if (slab->form == ADAPTIVE_DFVALUE)
+                slab->word_pool = create_alloc_pool("gdfa dfvalue slab words", 
+                                                    DFVALUE_WORD_COUNT * sizeof (SBITMAP_ELT_TYPE), 
+                                                    64);
+
+        for (row = 0; row < count; row++)
+        {
+                initialise_dfvalue_header (dfvalue_of_slab (slab, row), slab->form, 
+                                           &slab->obstack, slab->word_pool, false);
+                initialise_dfvalue (dfvalue_of_slab (slab, row), value);
+        }
+
+        return slab;
+}
+
+dfvalue
+dfvalue_of_slab (dfvalue_slab slab, int row)
+{
+        return (dfvalue) (slab->rows + row * slab->stride);
+}
+
+void
+free_dfvalue_slab (dfvalue_slab slab)
+{
+        if (slab == NULL)
+                return;
+        if (slab->form != DENSE_DFVALUE)
+                bitmap_obstack_release (&slab->obstack);
+        if (slab->word_pool)
+                free_alloc_pool (slab->word_pool);
+        XDELETEVEC (slab->memory);
+        XDELETE (slab);
+}
+
+/* Interned dfvalues are immutable dfvalues shared by all the preserved
+   results with the same members, whatever their analysis; preserved
+   results are read only, so none of them needs a private copy.
+   intern_dfvalue returns the interned dfvalue with the members of value,
+   making one in the form of value the first time, and counts a
+   reference to it; release_interned_dfvalue drops a reference and frees
+   the dfvalue with the last one. Values are hashed and compared through
+   their dense words, so that equal values in different forms meet. Their
+   own headers are used throughout, since they outlive the analysis that
+   made them.
+*/
+
+typedef struct interned_dfvalue
+{
+        dfvalue value;
+        hashval_t hash;
+        int references;
+} interned_dfvalue;
+
+static htab_t interned_dfvalues = NULL;
+static SBITMAP_ELT_TYPE * interning_words[2] = { NULL, NULL };
+static unsigned int interning_word_count = 0;
+
+/* The dense words of value in the interning buffer which. The deltas
+   below use these buffers too. */
+
+static SBITMAP_ELT_TYPE *
+interning_words_of (dfvalue value, int which)
+{
+        unsigned int i;
+
+        if (value->size > interning_word_count)
+        {
+                interning_word_count = value->size;
+                for (i = 0; i < 2; i++)
+                        interning_words[i] = XRESIZEVEC (SBITMAP_ELT_TYPE, interning_words[i],
+                                                         interning_word_count);
+        }
+        fill_words_from_dfvalue (interning_words[which], value);
+        return interning_words[which];
+}
+
+static hashval_t
+hash_of_dfvalue (dfvalue value)
+{
+        return iterative_hash (interning_words_of (value, 0), 
+                               value->size * sizeof (SBITMAP_ELT_TYPE),
+                               value->n_bits);
+}
+
+static hashval_t
+interned_dfvalue_hash (const void *entry)
+{
+        return ((const interned_dfvalue *) entry)->hash;
+}
+
+static int
+interned_dfvalue_eq (const void *entry, const void *key)
+{
+        dfvalue interned = ((const interned_dfvalue *) entry)->value;
+        dfvalue value = (dfvalue) key;
+
+        if (interned == value)
+                return true;
+        if (interned->n_bits != value->n_bits)
+                return false;
+        return memcmp (interning_words_of (interned, 0), interning_words_of (value, 1),
+                       value->size * sizeof (SBITMAP_ELT_TYPE)) == 0;
+}
+
+dfvalue
+intern_dfvalue (dfvalue value)
+{
+        interned_dfvalue * entry;
+        hashval_t hash;
+        void ** slot;
+
+        if (!interned_dfvalues)
+                interned_dfvalues = htab_create (64, interned_dfvalue_hash, 
+                                                 interned_dfvalue_eq, NULL);
+
+        hash = hash_of_dfvalue (value);
+        slot = htab_find_slot_with_hash (interned_dfvalues, value, hash, INSERT);
+        if (!*slot)
+        {
+                entry = XNEW (interned_dfvalue);
+                entry->hash = hash;
+                entry->references = 0;
+                entry->value = make_unpooled_dfvalue (value->form, value->n_bits);
+                copy_dfvalue_into (entry->value, value);
+                *slot = entry;
+        }
+
+        entry = (interned_dfvalue *) *slot;
+        entry->references++;
+        return entry->value;
+}
+
+void
+release_interned_dfvalue (dfvalue value)
+{
+        interned_dfvalue * entry;
+        void ** slot;
+
+        slot = htab_find_slot_with_hash (interned_dfvalues, value, hash_of_dfvalue (value), 
+                                         NO_INSERT);
+        entry = (interned_dfvalue *) *slot;
+        if (--entry->references > 0)
+                return;
+
+        htab_clear_slot (interned_dfvalues, slot);
+        free_dfvalue_space (entry->value);
+        XDELETE (entry);
+
+        if (htab_elements (interned_dfvalues) == 0)
+        {
+                htab_delete (interned_dfvalues);
+                interned_dfvalues = NULL;
+                XDELETEVEC (interning_words[0]);
+                XDELETEVEC (interning_words[1]);
+                interning_words[0] = interning_words[1] = NULL;
+                interning_word_count = 0;
+        }
+}
+
+/* A dfvalue of the given form over a universe of n_bits entities,
+   allocated outside the pool so that it outlives the analysis. */
+
+dfvalue
+make_unpooled_dfvalue (dfvalue_form form, unsigned int n_bits)
+{
+        dfvalue value;
+
+        value = (dfvalue) XNEWVAR (struct dfvalue_def, dfvalue_size_for (form, n_bits));
+        initialise_dfvalue_header_for (value, form, n_bits, &bitmap_default_obstack, 
+                                       NULL, false);
+        return value;
+}
+
+/* A dfvalue delta lists, in increasing order, the entities in which a
+   dfvalue differs from a base dfvalue over the same universe; applying
+   it to the base toggles them and gives back the dfvalue. Deltas are
+   symmetric, so that a chain of them can be applied in either
+   direction. */
+
+struct dfvalue_delta_def
+{
+        unsigned int size;
+        unsigned int entities[1];
+};
+
+/* The delta of value against base, or NULL if they differ in more than
+   limit entities. */
+
+dfvalue_delta
+make_dfvalue_delta (dfvalue value, dfvalue base, unsigned int limit)
+{
+        SBITMAP_ELT_TYPE *words, *base_words, difference;
+        dfvalue_delta delta;
+        unsigned int word, size = 0;
+
+        if (value->n_bits != base->n_bits)
+                return NULL;
+
+        words = interning_words_of (value, 0);
+        base_words = interning_words_of (base, 1);
+        for (word = 0; word < value->size && size <= limit; word++)
+                size += dfvalue_word_popcount (words[word] ^ base_words[word]);
+        if (size > limit)
+                return NULL;
+
+        delta = (dfvalue_delta) XNEWVAR (struct dfvalue_delta_def, 
+                                         sizeof (struct dfvalue_delta_def) 
+                                         + size * sizeof (unsigned int));
+        delta->size = 0;
+        for (word = 0; word < value->size; word++)
+                for (difference = words[word] ^ base_words[word]; difference; 
+                     difference &= difference - 1)
+                        delta->entities[delta->size++] 
+                                = word * SBITMAP_ELT_BITS 
+                                  + dfvalue_word_popcount ((difference & -difference) - 1);
+        return delta;
+}
+
+/* Writes into entities, in increasing order, the entities in which
+   value and base differ, and returns how many there are. entities must
+   have room for the whole universe. Unlike a delta, nothing is
+   allocated, and plain dense operands are read where they lie. */
+
+unsigned int
+dfvalue_differences (dfvalue value, dfvalue base, unsigned int *entities)
+{
+        SBITMAP_ELT_TYPE *words, *base_words, difference;
+        unsigned int word, size = 0;
+
+        words = value->form == DENSE_DFVALUE ? DFVALUE_WORDS (value) 
+                                             : interning_words_of (value, 0);
+        base_words = base->form == DENSE_DFVALUE ? DFVALUE_WORDS (base) 
+                                                 : interning_words_of (base, 1);
+        for (word = 0; word < value->size; word++)
+                for (difference = words[word] ^ base_words[word]; difference; 
+                     difference &= difference - 1)
+                        entities[size++] = word * SBITMAP_ELT_BITS 
+                                           + dfvalue_word_popcount ((difference & -difference) - 1);
+        return size;
+}
+
+unsigned int
+dfvalue_delta_size (dfvalue_delta delta)
+{
+        return delta->size;
+}
+
+void
+apply_dfvalue_delta (dfvalue value, dfvalue_delta delta)
+{
+        unsigned int i;
+
+        for (i = 0; i < delta->size; i++)
+                if (dfvalue_bit_p (value, delta->entities[i]))
+                        reset_dfvalue_bit (value, delta->entities[i]);
+                else
+                        set_dfvalue_bit (value, delta->entities[i]);
+}
+
+void
+free_dfvalue_delta (dfvalue_delta delta)
+{
+        XDELETE (delta);
+}
+
+/* Spans. The span of a dfvalue is a range of words, [span_start,
+   span_end), outside of which its dense words are known to be zero. It
+   covers every word until compute_dfvalue_span narrows it, and again
+   from the next write on; only plain dense dfvalues that are not small
+   are narrowed. An empty dfvalue gets an empty span with span_start
+   past span_end. The gen-kill transfer confines itself to the spans of
+   GEN and KILL (see union_of_diff_in_span), which clustered entity
+   numbers (see cluster_entities) make a handful of words of each basic
+   block.
+*/
+
+void
+compute_dfvalue_span (dfvalue value)
+{
+        unsigned int start = 0, end = value->size;
+
+        if (!DFVALUE_PLAIN_DENSE_P (value) || DFVALUE_SMALL_P (value))
+                return;
+
+        while (start < end && DFVALUE_WORDS (value)[start] == 0)
+                start++;
+        while (end > start && DFVALUE_WORDS (value)[end - 1] == 0)
+                end--;
+        if (start == end)
+        {
+                start = value->size;
+                end = 0;
+        }
+        value->span_start = start;
+        value->span_end = end;
+}
+
+/* Single entities. The local properties are built up with these. An
+   adaptive dfvalue leaves the run form when a change needs more runs
+   than it holds. */
+
+void
+set_dfvalue_bit (dfvalue value, int index)
+{
+        struct dfvalue_def entity;
+
+        DFVALUE_FORGET_SPAN (value);
+        switch (value->form)
+        {
+                case DENSE_DFVALUE:
+                        DFVALUE_WORDS (value)[index / SBITMAP_ELT_BITS] |= DFVALUE_WORD_BIT (index);
+                        break;
+                case SPARSE_DFVALUE:
+                        bitmap_set_bit (&value->sparse, index);
+                        break;
+                default:
+                        entity.run_count = 1;
+                        entity.runs[0] = index;
+                        entity.runs[1] = index + 1;
+                        if (!combine_dfvalue_runs (value, DFVALUE_OR, value, &entity, NULL))
+                        {
+                                spill_dfvalue_runs (value);
+                                set_dfvalue_bit (value, index);
+                        }
+                        break;
+        }
+}
+
+void
+reset_dfvalue_bit (dfvalue value, int index)
+{
+        struct dfvalue_def entity;
+
+        switch (value->form)
+        {
+                case DENSE_DFVALUE:
+                        DFVALUE_WORDS (value)[index / SBITMAP_ELT_BITS] &= ~DFVALUE_WORD_BIT (index);
+                        break;
+                case SPARSE_DFVALUE:
+                        bitmap_clear_bit (&value->sparse, index);
+                        break;
+                default:
+                        entity.run_count = 1;
+                        entity.runs[0] = index;
+                        entity.runs[1] = index + 1;
+                        if (!combine_dfvalue_runs (value, DFVALUE_UNION_OF_DIFF, NULL, value, &entity))
+                        {
+                                spill_dfvalue_runs (value);
+                                reset_dfvalue_bit (value, index);
+                        }
+                        break;
+        }
+}
+
+bool
+dfvalue_bit_p (dfvalue value, int index)
+{
+        switch (value->form)
+        {
+                case DENSE_DFVALUE:
+                        return DFVALUE_WORD_BIT_P (DFVALUE_WORDS (value), index);
+                case SPARSE_DFVALUE:
+                        return bitmap_bit_p (&value->sparse, index);
+                default:
+                        return run_member_p (value, index);
+        }
+}
+
+/* Returns the least member of value not less than index, or -1 if
+   there is none, so that the members can be visited in increasing order
+   without testing every entity. */
+
+int
+next_dfvalue_member (dfvalue value, int index)
+{
+        SBITMAP_ELT_TYPE word;
+        unsigned int i, member;
+        bitmap_iterator bi;
+
+        if (index < 0)
+                index = 0;
+        if ((unsigned int) index >= value->n_bits)
+                return -1;
+
+        switch (value->form)
+        {
+                case DENSE_DFVALUE:
+                        i = index / SBITMAP_ELT_BITS;
+                        word = DFVALUE_WORDS (value)[i] & ~(DFVALUE_WORD_BIT (index) - 1);
+                        while (word == 0)
+                        {
+                                if (++i >= value->size)
+                                        return -1;
+                                word = DFVALUE_WORDS (value)[i];
+                        }
+                        for (member = 0; !(word & DFVALUE_WORD_BIT (member)); member++)
+                                ;
+                        return i * SBITMAP_ELT_BITS + member;
+                case SPARSE_DFVALUE:
+                        EXECUTE_IF_SET_IN_BITMAP (&value->sparse, index, member, bi)
+                                return member;
+                        return -1;
+                default:
+                        for (i = 0; i < value->run_count; i++)
+                                if ((unsigned int) index < value->runs[2 * i + 1])
+                                        return MAX ((unsigned int) index, value->runs[2 * i]);
+                        return -1;
+        }
+}
+
+bool
+dfvalues_intersect_p (dfvalue value1, dfvalue value2)
+{
+        dfvalue_form form = denser_dfvalue_form (value1->form, value2->form);
+        dfvalue a, b;
+        bool intersect = false;
+        unsigned int i, j;
+
+        if (form == RUN_DFVALUE)
+        {
+                for (i = 0; i < value1->run_count; i++)
+                        for (j = 0; j < value2->run_count; j++)
+                                if (value1->runs[2 * i] < value2->runs[2 * j + 1]
+                                    && value2->runs[2 * j] < value1->runs[2 * i + 1])
+                                        return true;
+                return false;
+        }
+
+        a = dfvalue_in_form (value1, form);
+        b = dfvalue_in_form (value2, form);
+        if (form == DENSE_DFVALUE)
+        {
+                for (i = 0; i < a->size && !intersect; i++)
+                        intersect = (DFVALUE_WORDS (a)[i] & DFVALUE_WORDS (b)[i]) != 0;
+        }
+        else
+                intersect = bitmap_intersect_p (&a->sparse, &b->sparse);
+
+        release_dfvalue_in_form (a, value1);
+        release_dfvalue_in_form (b, value2);
+        return intersect;
+}
+
+/* Every form is dumped as an sbitmap, so the dumps do not depend on
+   the representation chosen by the specification. */
+
+void
+dump_dfvalue (FILE * file, dfvalue value)
+{
+        dfvalue temp = value;
+        sbitmap bits;
+
+        if (value->form != DENSE_DFVALUE || value->adaptive)
+        {
+                temp = make_dfvalue_of_form (DENSE_DFVALUE);
+                copy_dfvalue_into (temp, value);
+        }
+        bits = sbitmap_alloc (temp->n_bits);
+        memcpy (bits->elms, DFVALUE_WORDS (temp), bits->size * sizeof (SBITMAP_ELT_TYPE));
+	dump_sbitmap(file, bits);
+        sbitmap_free (bits);
+        release_dfvalue_in_form (temp, value);
+}
+
+/* Starts the statistics of a new analysis; the pools it creates add to
+   them. */
+
+void
+clear_dfvalue_statistics (void)
+{
+        memset (dfvalue_form_results, 0, sizeof (dfvalue_form_results));
+        dfvalue_form_changes = 0;
+        adaptive_dfvalues_used = false;
+}
+
+/* Prints how often the results of operations on adaptive dfvalues took
+   each form during the current analysis, and how often they changed
+   their form, if the analysis uses adaptive dfvalues. */
+
+void
+dump_dfvalue_statistics (FILE * file)
+{
+        if (!adaptive_dfvalues_used)
+                return;
+        fprintf (file, "\n Adaptive dfvalue results: Dense = %lu, Sparse = %lu, Runs = %lu, "
+                 "Changes of form = %lu *******\n",
+                 dfvalue_form_results[DENSE_DFVALUE - 1], 
+                 dfvalue_form_results[SPARSE_DFVALUE - 1],
+                 dfvalue_form_results[RUN_DFVALUE - 1],
+                 dfvalue_form_changes);
+}
@@ -54,23 +54,23 @@ typedef struct expr_template
 
 #define GEN_nid(dfi,nid)   ((dfi)[nid]->gen)
 #define KILL_nid(dfi,nid)   ((dfi)[nid]->kill)
-#define IN_nid(dfi,nid)   ((dfi)[nid]->in)
-#define OUT_nid(dfi,nid)   ((dfi)[nid]->out)
+#define IN_nid(dfi,nid)   ((dfi)[nid]->delta ? decoded_dfvalue((dfi)[nid], false) : (dfi)[nid]->in)
+#define OUT_nid(dfi,nid)   ((dfi)[nid]->delta ? decoded_dfvalue((dfi)[nid], true) : (dfi)[nid]->out)
 
 
 #define GEN(dfi,bb)   ((dfi)[find_index_bb(bb)]->gen)
 #define KILL(dfi,bb)   ((dfi)[find_index_bb(bb)]->kill)
-#define IN(dfi,bb)   ((dfi)[find_index_bb(bb)]->in)
-#define OUT(dfi,bb)   ((dfi)[find_index_bb(bb)]->out)
+#define IN(dfi,bb)   (decoded_dfvalue((dfi)[find_index_bb(bb)], false))
+#define OUT(dfi,bb)   (decoded_dfvalue((dfi)[find_index_bb(bb)], true))
 /*@Non-separable : START*/
-#define GEN_OF_STMT(dfi,stmt)     ((dfi)[find_index_of_local_stmt(stmt)]->gen)
-#define KILL_OF_STMT(dfi,stmt)    ((dfi)[find_index_of_local_stmt(stmt)]->kill)
-#define IN_OF_STMT(dfi,stmt)      ((dfi)[find_index_of_local_stmt(stmt)]->in)
-#define OUT_OF_STMT(dfi,stmt)     ((dfi)[find_index_of_local_stmt(stmt)]->out)
-#define GEN_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->gen)
-#define KILL_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->kill)
-#define IN_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->in)
-#define OUT_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->out)
+#define GEN_OF_STMT(dfi,stmt)     (local_dfvalue_of_stmt((dfi)[find_index_of_local_stmt(stmt)], false))
+#define KILL_OF_STMT(dfi,stmt)    (local_dfvalue_of_stmt((dfi)[find_index_of_local_stmt(stmt)], true))
+#define IN_OF_STMT(dfi,stmt)      (decoded_dfvalue((dfi)[find_index_of_local_stmt(stmt)], false))
+#define OUT_OF_STMT(dfi,stmt)     (decoded_dfvalue((dfi)[find_index_of_local_stmt(stmt)], true))
+#define GEN_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->delta ? local_dfvalue_of_stmt((dfi)[nid], false) : (dfi)[nid]->gen)
+#define KILL_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->delta ? local_dfvalue_of_stmt((dfi)[nid], true) : (dfi)[nid]->kill)
+#define IN_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->delta ? decoded_dfvalue((dfi)[nid], false) : (dfi)[nid]->in)
+#define OUT_OF_STMT_nid(dfi,nid)   ((dfi)[nid]->delta ? decoded_dfvalue((dfi)[nid], true) : (dfi)[nid]->out)
 /*@Non-separable : END*/
 
 #define FOR_EACH_BB_IN_SPECIFIED_TRAVERSAL_ORDER         \
@@ -81,10 +81,91 @@ typedef struct expr_template
                                         : visit_bb-- \
            )
 
-typedef sbitmap dfvalue;
+/* A dfvalue is a set of entities kept in one of three forms. The dense
+   form is a vector of words holding relevant_pfbv_entity_count bits,
+   laid out as in an sbitmap; the words of a plain dense dfvalue follow
+   the structure. The sparse form is a GCC
+   bitmap of the indices of the members, which costs memory only for
+   the elements holding members. The run form lists up to
+   DFVALUE_MAX_RUNS runs of consecutive members, [start, end) in
+   increasing order, inside the structure itself; it suits sets such as
+   the universe, which ONES-initialised analyses start from. Every form
+   keeps n_bits and size, so that it knows the size of the universe.
+
+   The representation field of a specification chooses the form of the
+   dfvalues of its analysis. DENSE_DFVALUE and SPARSE_DFVALUE fix the
+   form. ADAPTIVE_DFVALUE makes every dfvalue adaptive: after each
+   operation it moves to the form which suits its members best (see
+   adapt_dfvalue), keeping the words of its dense form apart. The run
+   form is used by adaptive dfvalues only. The dfvalue interface accepts
+   operands of any form.
+*/
+
+typedef enum dfvalue_form
+                {
+                        DENSE_DFVALUE=1,
+                        SPARSE_DFVALUE,
+                        RUN_DFVALUE,
+                        ADAPTIVE_DFVALUE
+                } dfvalue_form;
 
+#define DFVALUE_MAX_RUNS 4
 
-/* Data structure to hold data flow information bit vectors */
+/* Universes of at most DFVALUE_SMALL_WORDS words, which covers most
+   functions, are always kept dense whatever the representation of the
+   specification: a word or two is smaller than any other form. Their
+   dfvalues are small: the words are held in small_words, the header
+   ends there, and the operations on them are straight-line code on
+   both words, which are kept clear past n_bits, without going through
+   the kernels. */
+
+#define DFVALUE_SMALL_WORDS 2
+
+typedef struct dfvalue_def
+{
+        /* Every dfvalue starts with these; a small dfvalue has no more */
+        unsigned int n_bits;                      /* entities in the universe */
+        unsigned int size;                        /* words of the dense form */
+        unsigned int span_start;                  /* see compute_dfvalue_span */
+        unsigned int span_end;
+        dfvalue_form form;
+        bool pooled;
+        bool adaptive;
+        bool small;
+        SBITMAP_ELT_TYPE * words;                 /* of the dense form */
+        SBITMAP_ELT_TYPE small_words[DFVALUE_SMALL_WORDS];
+
+        unsigned int run_count;
+        unsigned int runs[2 * DFVALUE_MAX_RUNS];
+        bitmap_head sparse;
+        struct alloc_pool_def * word_pool;        /* of adaptive dfvalues */
+        SBITMAP_ELT_TYPE elms[1];                 /* must be last */
+} * dfvalue;
+
+/* A slab of dfvalues stored contiguously (see make_dfvalue_slab) */
+
+typedef struct dfvalue_slab_def * dfvalue_slab;
+
+/* The entities in which a dfvalue differs from another one (see
+   make_dfvalue_delta) */
+
+typedef struct dfvalue_delta_def * dfvalue_delta;
+
+
+/* Data structure to hold data flow information bit vectors. IN and
+   OUT of a preserved dfi set may be kept as deltas against neighbouring
+   values (see encode_dfi_storage); they are then NULL here, and the IN
+   and OUT macros, or their _nid forms, decode them into a small cache.
+   The values of statements may also be kept at the boundaries of basic
+   blocks only and be replayed when they are read, GEN and KILL
+   included, so those of statements are read through the _OF_STMT
+   macros. A value read through the macros of a preserved dfi set stays
+   valid until the dfi set is released, when the next function is
+   initialised, except that a decoded value stays valid only until
+   several other values have been decoded (see decoded_dfvalue), and a
+   replayed value of a statement only until the statements of another
+   basic block are replayed. A client that keeps such a value copies it
+   with copy_decoded_dfvalue_into or copy_local_dfvalue_of_stmt_into. */
 
 typedef struct pfbv_dfi
 {
@@ -92,6 +173,7 @@ typedef struct pfbv_dfi
         dfvalue kill;
         dfvalue in;
         dfvalue out;
+        struct pfbv_dfi_delta * delta;
 } pfbv_dfi;
 
 
@@ -122,6 +204,25 @@ typedef enum dfi_to_be_preserved
                         no_value 
                 } dfi_to_be_preserved;
 
+/* ROUND_ROBIN sweeps over all basic blocks until no value changes.
+   WORKLIST revisits only the blocks whose inputs have changed, in
+   FIFO order. PRIORITY_WORKLIST revisits them in reverse postorder.
+   WEAK_TOPOLOGICAL_ORDER stabilises one loop component at a time.
+   HIERARCHICAL summarises loop components in closed form; it applies
+   to separable specs with the default gen-kill flows only and falls
+   back to WEAK_TOPOLOGICAL_ORDER otherwise. ELIMINATION solves the
+   same specs by Gaussian elimination, without iterating.
+*/
+typedef enum solver_strategy 
+                { 
+                        ROUND_ROBIN=1, 
+                        WORKLIST, 
+                        PRIORITY_WORKLIST, 
+                        WEAK_TOPOLOGICAL_ORDER, 
+                        HIERARCHICAL, 
+                        ELIMINATION 
+                } solver_strategy;
+
 typedef enum entity_occurrence  
                { 
                         up_exp=1, 
@@ -229,6 +330,8 @@ struct gimple_pfbv_dfa_spec
         entity_dependence         dependent_gen;
         entity_dependence         dependent_kill;
         /*@Non-separable : END*/
+        solver_strategy           solver;
+        dfvalue_form              representation;
 };
 
 
@@ -237,7 +340,9 @@ struct gimple_pfbv_dfa_spec
 
 pfbv_dfi ** pfbvdfa_driver(struct gimple_pfbv_dfa_spec dfa_spec);
 
-/* Default edge flow functions */
+/* Default edge flow functions. The identity and stop flows return
+   dfvalues owned by the driver; any other flow function must return a
+   newly allocated dfvalue, which the driver frees after use. */
 
 dfvalue identity_forward_edge_flow(basic_block src, basic_block dest);
 dfvalue identity_backward_edge_flow(basic_block src, basic_block dest);
@@ -258,9 +363,42 @@ void free_dfvalue_space(dfvalue value);
 dfvalue intersect_dfvalues (dfvalue value1, dfvalue value2);
 dfvalue union_dfvalues (dfvalue value1, dfvalue value2);
 dfvalue a_plus_b_minus_c(dfvalue v_a, dfvalue v_b, dfvalue v_c);
+dfvalue copy_dfvalue (dfvalue value);
 dfvalue make_initialised_dfvalue(initial_value value);
 dfvalue make_uninitialised_dfvalue(void);
+void intersect_dfvalues_into (dfvalue dest, dfvalue value1, dfvalue value2);
+void union_dfvalues_into (dfvalue dest, dfvalue value1, dfvalue value2);
+void a_plus_b_minus_c_into (dfvalue dest, dfvalue v_a, dfvalue v_b, dfvalue v_c);
+void copy_dfvalue_into (dfvalue dest, dfvalue value);
+bool update_dfvalue (dfvalue dest, dfvalue value);
+void initialise_dfvalue (dfvalue dest, initial_value value);
+bool meet_gen_kill_dfvalues_into (dfvalue dest, dfvalue *values, int count,
+                                  meet_operation confluence, dfvalue gen, dfvalue kill);
+bool meet_gen_kill_dfvalue_words_into (dfvalue dest, dfvalue *values, int count,
+                                       meet_operation confluence, dfvalue gen, dfvalue kill,
+                                       unsigned int first, unsigned int last);
+dfvalue_slab make_dfvalue_slab (int count, initial_value value);
+dfvalue dfvalue_of_slab (dfvalue_slab slab, int row);
+void free_dfvalue_slab (dfvalue_slab slab);
+dfvalue intern_dfvalue (dfvalue value);
+void release_interned_dfvalue (dfvalue value);
+dfvalue make_unpooled_dfvalue (dfvalue_form form, unsigned int n_bits);
+dfvalue_delta make_dfvalue_delta (dfvalue value, dfvalue base, unsigned int limit);
+unsigned int dfvalue_delta_size (dfvalue_delta delta);
+void apply_dfvalue_delta (dfvalue value, dfvalue_delta delta);
+void free_dfvalue_delta (dfvalue_delta delta);
+unsigned int dfvalue_differences (dfvalue value, dfvalue base, unsigned int *entities);
+void set_dfvalue_bit (dfvalue value, int index);
+void reset_dfvalue_bit (dfvalue value, int index);
+bool dfvalue_bit_p (dfvalue value, int index);
+int next_dfvalue_member (dfvalue value, int index);
+bool dfvalues_intersect_p (dfvalue value1, dfvalue value2);
+void compute_dfvalue_span (dfvalue value);
 void dump_dfvalue (FILE * file, dfvalue value);
+void clear_dfvalue_statistics (void);
+void dump_dfvalue_statistics (FILE * file);
+void create_dfvalue_pool(dfvalue_form form);
+void free_dfvalue_pool(void);
 
 /* helper functions */
 
@@ -274,6 +412,46 @@ int find_index_of_local_expr(tree expr);
 
 /**  End of helper functions **/
 
+/* CFG orders shared by all the gdfa passes of a function */
+
+void ensure_cfg_orders(void);
+void invalidate_cfg_orders(void);
+
+/* Release of the data flow information preserved for the previous function */
+
+void release_preserved_dfi(void);
+dfvalue decoded_dfvalue(pfbv_dfi * node, bool out);
+bool copy_decoded_dfvalue_into(dfvalue dest, pfbv_dfi * node, bool out);
+/*@Non-separable : START*/
+dfvalue local_dfvalue_of_stmt(pfbv_dfi * node, bool kill);
+bool copy_local_dfvalue_of_stmt_into(dfvalue dest, pfbv_dfi * node, bool kill);
+/*@Non-separable : END*/
+
+/* Transposed index of preserved data flow information of basic blocks,
+   giving the basic blocks at which an entity holds (see
+   index_dfi_by_entity) */
+
+typedef struct dfi_entity_index_def * dfi_entity_index;
+
+dfi_entity_index index_dfi_by_entity(pfbv_dfi ** dfi, bool out);
+bitmap bbs_of_entity(dfi_entity_index index, int entity);
+basic_block bb_at_index_position(dfi_entity_index index, int position);
+
+/*@Non-separable : START*/
+/* Sparse solution of a non-separable analysis of variables over SSA
+   form, giving the value of the entity of the variable of an SSA name
+   just after its definition (see gdfa_ssa_driver). Variables not of
+   register type are taken at bottom. gdfa_ssa_driver returns NULL for
+   a specification it cannot solve. */
+
+typedef struct ssa_dfi_def * ssa_dfi;
+
+ssa_dfi gdfa_ssa_driver(struct gimple_pfbv_dfa_spec dfa_spec);
+bool ssa_name_in_ssa_dfi(ssa_dfi dfi, tree name);
+void free_ssa_dfi(ssa_dfi dfi);
+void dump_ssa_dfi(FILE * file, ssa_dfi dfi);
+/*@Non-separable : END*/
+
 extern pfbv_dfi ** current_pfbv_dfi ;
 
 
@@ -530,6 +530,10 @@ init_optimization_passes (void)
 	  NEXT_PASS (pass_build_ssa);
 	  NEXT_PASS (pass_expand_omp_ssa);
 	  NEXT_PASS (pass_early_warn_uninitialized);
+	  /*@Non-separable : START*/
+	  NEXT_PASS (pass_gimple_pfbv_fv_ssa_dfa);
+	  NEXT_PASS (pass_gimple_pfbv_puv_ssa_dfa);
+	  /*@Non-separable : END*/
 	  NEXT_PASS (pass_rebuild_cgraph_edges);
 	  NEXT_PASS (pass_early_inline);
 	  NEXT_PASS (pass_cleanup_cfg);
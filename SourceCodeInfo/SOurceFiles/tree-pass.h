@@ -459,6 +459,8 @@ extern struct tree_opt_pass pass_gimple_pfbv_rd_dfa;
 /*@Non-separable : START*/
 extern struct tree_opt_pass pass_gimple_pfbv_fv_dfa;
 extern struct tree_opt_pass pass_gimple_pfbv_puv_dfa;
+extern struct tree_opt_pass pass_gimple_pfbv_fv_ssa_dfa;
+extern struct tree_opt_pass pass_gimple_pfbv_puv_ssa_dfa;
 /*@Non-separable : END*/
 
 /* The root of the compilation pass tree, once constructed.  */
@@ -0,0 +1,12 @@
+int f(int);
+int test(int p)
+{   int a, b, c, u, m;
+    int *q = &m;
+    a = p + 1;
+    if (p > 0)
+          b = a;
+    c = f(b);
+    u = 3;
+    *q = c;
+    return m + a;
+}
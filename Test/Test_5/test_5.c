@@ -0,0 +1,701 @@
+/* More variables, expressions and definitions than fit in the smallest
+   tile of entities, so that the separable analyses are solved in
+   several tiles when cc1 is built with GDFA_TILE_BYTES or GDFA_THREADS
+   (see check-tiling in ../Makefile). */
+int test(int n)
+{   int v0, v1, v2, v3, v4, v5, v6, v7, v8, v9;
+    int v10, v11, v12, v13, v14, v15, v16, v17, v18, v19;
+    int v20, v21, v22, v23, v24, v25, v26, v27, v28, v29;
+    int v30, v31, v32, v33, v34, v35, v36, v37, v38, v39;
+    int v40, v41, v42, v43, v44, v45, v46, v47, v48, v49;
+    int v50, v51, v52, v53, v54, v55, v56, v57, v58, v59;
+    int v60, v61, v62, v63, v64, v65, v66, v67, v68, v69;
+    int v70, v71, v72, v73, v74, v75, v76, v77, v78, v79;
+    int v80, v81, v82, v83, v84, v85, v86, v87, v88, v89;
+    int v90, v91, v92, v93, v94, v95, v96, v97, v98, v99;
+    int v100, v101, v102, v103, v104, v105, v106, v107, v108, v109;
+    int v110, v111, v112, v113, v114, v115, v116, v117, v118, v119;
+    int v120, v121, v122, v123, v124, v125, v126, v127, v128, v129;
+    int v130, v131, v132, v133, v134, v135, v136, v137, v138, v139;
+    int v140, v141, v142, v143, v144, v145, v146, v147, v148, v149;
+    int v150, v151, v152, v153, v154, v155, v156, v157, v158, v159;
+    int v160, v161, v162, v163, v164, v165, v166, v167, v168, v169;
+    int v170, v171, v172, v173, v174, v175, v176, v177, v178, v179;
+    int v180, v181, v182, v183, v184, v185, v186, v187, v188, v189;
+    int v190, v191, v192, v193, v194, v195, v196, v197, v198, v199;
+    int v200, v201, v202, v203, v204, v205, v206, v207, v208, v209;
+    int v210, v211, v212, v213, v214, v215, v216, v217, v218, v219;
+    int v220, v221, v222, v223, v224, v225, v226, v227, v228, v229;
+    int v230, v231, v232, v233, v234, v235, v236, v237, v238, v239;
+    int v240, v241, v242, v243, v244, v245, v246, v247, v248, v249;
+    int v250, v251, v252, v253, v254, v255, v256, v257, v258, v259;
+    int v260, v261, v262, v263, v264, v265, v266, v267, v268, v269;
+    int v270, v271, v272, v273, v274, v275, v276, v277, v278, v279;
+    int v280, v281, v282, v283, v284, v285, v286, v287, v288, v289;
+    int v290, v291, v292, v293, v294, v295, v296, v297, v298, v299;
+    int v300, v301, v302, v303, v304, v305, v306, v307, v308, v309;
+    int v310, v311, v312, v313, v314, v315, v316, v317, v318, v319;
+    int v320, v321, v322, v323, v324, v325, v326, v327, v328, v329;
+    int v330, v331, v332, v333, v334, v335, v336, v337, v338, v339;
+    int v340, v341, v342, v343, v344, v345, v346, v347, v348, v349;
+    int v350, v351, v352, v353, v354, v355, v356, v357, v358, v359;
+    int v360, v361, v362, v363, v364, v365, v366, v367, v368, v369;
+    int v370, v371, v372, v373, v374, v375, v376, v377, v378, v379;
+    int v380, v381, v382, v383, v384, v385, v386, v387, v388, v389;
+    int v390, v391, v392, v393, v394, v395, v396, v397, v398, v399;
+    int v400, v401, v402, v403, v404, v405, v406, v407, v408, v409;
+    int v410, v411, v412, v413, v414, v415, v416, v417, v418, v419;
+    int v420, v421, v422, v423, v424, v425, v426, v427, v428, v429;
+    int v430, v431, v432, v433, v434, v435, v436, v437, v438, v439;
+    int v440, v441, v442, v443, v444, v445, v446, v447, v448, v449;
+    int v450, v451, v452, v453, v454, v455, v456, v457, v458, v459;
+    int v460, v461, v462, v463, v464, v465, v466, v467, v468, v469;
+    int v470, v471, v472, v473, v474, v475, v476, v477, v478, v479;
+    int v480, v481, v482, v483, v484, v485, v486, v487, v488, v489;
+    int v490, v491, v492, v493, v494, v495, v496, v497, v498, v499;
+    int v500, v501, v502, v503, v504, v505, v506, v507, v508, v509;
+    int v510, v511, v512, v513, v514, v515, v516, v517, v518, v519;
+    int v520, v521, v522, v523, v524, v525, v526, v527, v528, v529;
+    int v530, v531, v532, v533, v534, v535, v536, v537, v538, v539;
+    int v540, v541, v542, v543, v544, v545, v546, v547, v548, v549;
+    int v550, v551, v552, v553, v554, v555, v556, v557, v558, v559;
+    int v560, v561, v562, v563, v564, v565, v566, v567, v568, v569;
+    int v570, v571, v572, v573, v574, v575, v576, v577, v578, v579;
+    int v580, v581, v582, v583, v584, v585, v586, v587, v588, v589;
+    int v590, v591, v592, v593, v594, v595, v596, v597, v598, v599;
+    int v600, v601, v602, v603, v604, v605, v606, v607, v608, v609;
+    int v610, v611, v612, v613, v614, v615, v616, v617, v618, v619;
+    int v620, v621, v622, v623, v624, v625, v626, v627, v628, v629;
+    int v630, v631, v632, v633, v634, v635, v636, v637, v638, v639;
+    int v640, v641, v642, v643, v644, v645, v646, v647, v648, v649;
+    int v650, v651, v652, v653, v654, v655, v656, v657, v658, v659;
+    int v660, v661, v662, v663, v664, v665, v666, v667, v668, v669;
+    int v670, v671, v672, v673, v674, v675, v676, v677, v678, v679;
+    int v680, v681, v682, v683, v684, v685, v686, v687, v688, v689;
+    int v690, v691, v692, v693, v694, v695, v696, v697, v698, v699;
+    int v700, v701, v702, v703, v704, v705, v706, v707, v708, v709;
+    int v710, v711, v712, v713, v714, v715, v716, v717, v718, v719;
+    int v720, v721, v722, v723, v724, v725, v726, v727, v728, v729;
+    int v730, v731, v732, v733, v734, v735, v736, v737, v738, v739;
+    int v740, v741, v742, v743, v744, v745, v746, v747, v748, v749;
+    int v750, v751, v752, v753, v754, v755, v756, v757, v758, v759;
+    int v760, v761, v762, v763, v764, v765, v766, v767, v768, v769;
+    int v770, v771, v772, v773, v774, v775, v776, v777, v778, v779;
+    int v780, v781, v782, v783, v784, v785, v786, v787, v788, v789;
+    int v790, v791, v792, v793, v794, v795, v796, v797, v798, v799;
+    int v800, v801, v802, v803, v804, v805, v806, v807, v808, v809;
+    int v810, v811, v812, v813, v814, v815, v816, v817, v818, v819;
+    int v820, v821, v822, v823, v824, v825, v826, v827, v828, v829;
+    int v830, v831, v832, v833, v834, v835, v836, v837, v838, v839;
+    int v840, v841, v842, v843, v844, v845, v846, v847, v848, v849;
+    int v850, v851, v852, v853, v854, v855, v856, v857, v858, v859;
+    int v860, v861, v862, v863, v864, v865, v866, v867, v868, v869;
+    int v870, v871, v872, v873, v874, v875, v876, v877, v878, v879;
+    int v880, v881, v882, v883, v884, v885, v886, v887, v888, v889;
+    int v890, v891, v892, v893, v894, v895, v896, v897, v898, v899;
+    v1 = n + 0;
+    v4 = n + 1;
+    v7 = n + 2;
+    v10 = n + 3;
+    v13 = n + 4;
+    v16 = n + 5;
+    v19 = n + 6;
+    v22 = n + 7;
+    v25 = n + 8;
+    v28 = n + 9;
+    v31 = n + 10;
+    v34 = n + 11;
+    v37 = n + 12;
+    v40 = n + 13;
+    v43 = n + 14;
+    v46 = n + 15;
+    v49 = n + 16;
+    v52 = n + 17;
+    v55 = n + 18;
+    v58 = n + 19;
+    v61 = n + 20;
+    v64 = n + 21;
+    v67 = n + 22;
+    v70 = n + 23;
+    v73 = n + 24;
+    v76 = n + 25;
+    v79 = n + 26;
+    v82 = n + 27;
+    v85 = n + 28;
+    v88 = n + 29;
+    v91 = n + 30;
+    v94 = n + 31;
+    v97 = n + 32;
+    v100 = n + 33;
+    v103 = n + 34;
+    v106 = n + 35;
+    v109 = n + 36;
+    v112 = n + 37;
+    v115 = n + 38;
+    v118 = n + 39;
+    v121 = n + 40;
+    v124 = n + 41;
+    v127 = n + 42;
+    v130 = n + 43;
+    v133 = n + 44;
+    v136 = n + 45;
+    v139 = n + 46;
+    v142 = n + 47;
+    v145 = n + 48;
+    v148 = n + 49;
+    v151 = n + 50;
+    v154 = n + 51;
+    v157 = n + 52;
+    v160 = n + 53;
+    v163 = n + 54;
+    v166 = n + 55;
+    v169 = n + 56;
+    v172 = n + 57;
+    v175 = n + 58;
+    v178 = n + 59;
+    v181 = n + 60;
+    v184 = n + 61;
+    v187 = n + 62;
+    v190 = n + 63;
+    v193 = n + 64;
+    v196 = n + 65;
+    v199 = n + 66;
+    v202 = n + 67;
+    v205 = n + 68;
+    v208 = n + 69;
+    v211 = n + 70;
+    v214 = n + 71;
+    v217 = n + 72;
+    v220 = n + 73;
+    v223 = n + 74;
+    v226 = n + 75;
+    v229 = n + 76;
+    v232 = n + 77;
+    v235 = n + 78;
+    v238 = n + 79;
+    v241 = n + 80;
+    v244 = n + 81;
+    v247 = n + 82;
+    v250 = n + 83;
+    v253 = n + 84;
+    v256 = n + 85;
+    v259 = n + 86;
+    v262 = n + 87;
+    v265 = n + 88;
+    v268 = n + 89;
+    v271 = n + 90;
+    v274 = n + 91;
+    v277 = n + 92;
+    v280 = n + 93;
+    v283 = n + 94;
+    v286 = n + 95;
+    v289 = n + 96;
+    v292 = n + 97;
+    v295 = n + 98;
+    v298 = n + 99;
+    v301 = n + 100;
+    v304 = n + 101;
+    v307 = n + 102;
+    v310 = n + 103;
+    v313 = n + 104;
+    v316 = n + 105;
+    v319 = n + 106;
+    v322 = n + 107;
+    v325 = n + 108;
+    v328 = n + 109;
+    v331 = n + 110;
+    v334 = n + 111;
+    v337 = n + 112;
+    v340 = n + 113;
+    v343 = n + 114;
+    v346 = n + 115;
+    v349 = n + 116;
+    v352 = n + 117;
+    v355 = n + 118;
+    v358 = n + 119;
+    v361 = n + 120;
+    v364 = n + 121;
+    v367 = n + 122;
+    v370 = n + 123;
+    v373 = n + 124;
+    v376 = n + 125;
+    v379 = n + 126;
+    v382 = n + 127;
+    v385 = n + 128;
+    v388 = n + 129;
+    v391 = n + 130;
+    v394 = n + 131;
+    v397 = n + 132;
+    v400 = n + 133;
+    v403 = n + 134;
+    v406 = n + 135;
+    v409 = n + 136;
+    v412 = n + 137;
+    v415 = n + 138;
+    v418 = n + 139;
+    v421 = n + 140;
+    v424 = n + 141;
+    v427 = n + 142;
+    v430 = n + 143;
+    v433 = n + 144;
+    v436 = n + 145;
+    v439 = n + 146;
+    v442 = n + 147;
+    v445 = n + 148;
+    v448 = n + 149;
+    v451 = n + 150;
+    v454 = n + 151;
+    v457 = n + 152;
+    v460 = n + 153;
+    v463 = n + 154;
+    v466 = n + 155;
+    v469 = n + 156;
+    v472 = n + 157;
+    v475 = n + 158;
+    v478 = n + 159;
+    v481 = n + 160;
+    v484 = n + 161;
+    v487 = n + 162;
+    v490 = n + 163;
+    v493 = n + 164;
+    v496 = n + 165;
+    v499 = n + 166;
+    v502 = n + 167;
+    v505 = n + 168;
+    v508 = n + 169;
+    v511 = n + 170;
+    v514 = n + 171;
+    v517 = n + 172;
+    v520 = n + 173;
+    v523 = n + 174;
+    v526 = n + 175;
+    v529 = n + 176;
+    v532 = n + 177;
+    v535 = n + 178;
+    v538 = n + 179;
+    v541 = n + 180;
+    v544 = n + 181;
+    v547 = n + 182;
+    v550 = n + 183;
+    v553 = n + 184;
+    v556 = n + 185;
+    v559 = n + 186;
+    v562 = n + 187;
+    v565 = n + 188;
+    v568 = n + 189;
+    v571 = n + 190;
+    v574 = n + 191;
+    v577 = n + 192;
+    v580 = n + 193;
+    v583 = n + 194;
+    v586 = n + 195;
+    v589 = n + 196;
+    v592 = n + 197;
+    v595 = n + 198;
+    v598 = n + 199;
+    v601 = n + 200;
+    v604 = n + 201;
+    v607 = n + 202;
+    v610 = n + 203;
+    v613 = n + 204;
+    v616 = n + 205;
+    v619 = n + 206;
+    v622 = n + 207;
+    v625 = n + 208;
+    v628 = n + 209;
+    v631 = n + 210;
+    v634 = n + 211;
+    v637 = n + 212;
+    v640 = n + 213;
+    v643 = n + 214;
+    v646 = n + 215;
+    v649 = n + 216;
+    v652 = n + 217;
+    v655 = n + 218;
+    v658 = n + 219;
+    v661 = n + 220;
+    v664 = n + 221;
+    v667 = n + 222;
+    v670 = n + 223;
+    v673 = n + 224;
+    v676 = n + 225;
+    v679 = n + 226;
+    v682 = n + 227;
+    v685 = n + 228;
+    v688 = n + 229;
+    v691 = n + 230;
+    v694 = n + 231;
+    v697 = n + 232;
+    v700 = n + 233;
+    v703 = n + 234;
+    v706 = n + 235;
+    v709 = n + 236;
+    v712 = n + 237;
+    v715 = n + 238;
+    v718 = n + 239;
+    v721 = n + 240;
+    v724 = n + 241;
+    v727 = n + 242;
+    v730 = n + 243;
+    v733 = n + 244;
+    v736 = n + 245;
+    v739 = n + 246;
+    v742 = n + 247;
+    v745 = n + 248;
+    v748 = n + 249;
+    v751 = n + 250;
+    v754 = n + 251;
+    v757 = n + 252;
+    v760 = n + 253;
+    v763 = n + 254;
+    v766 = n + 255;
+    v769 = n + 256;
+    v772 = n + 257;
+    v775 = n + 258;
+    v778 = n + 259;
+    v781 = n + 260;
+    v784 = n + 261;
+    v787 = n + 262;
+    v790 = n + 263;
+    v793 = n + 264;
+    v796 = n + 265;
+    v799 = n + 266;
+    v802 = n + 267;
+    v805 = n + 268;
+    v808 = n + 269;
+    v811 = n + 270;
+    v814 = n + 271;
+    v817 = n + 272;
+    v820 = n + 273;
+    v823 = n + 274;
+    v826 = n + 275;
+    v829 = n + 276;
+    v832 = n + 277;
+    v835 = n + 278;
+    v838 = n + 279;
+    v841 = n + 280;
+    v844 = n + 281;
+    v847 = n + 282;
+    v850 = n + 283;
+    v853 = n + 284;
+    v856 = n + 285;
+    v859 = n + 286;
+    v862 = n + 287;
+    v865 = n + 288;
+    v868 = n + 289;
+    v871 = n + 290;
+    v874 = n + 291;
+    v877 = n + 292;
+    v880 = n + 293;
+    v883 = n + 294;
+    v886 = n + 295;
+    v889 = n + 296;
+    v892 = n + 297;
+    v895 = n + 298;
+    v898 = n + 299;
+    while (n > 0)
+    {
+        v0 = v1 * v2;
+        v3 = v4 * v5;
+        v6 = v7 * v8;
+        v9 = v10 * v11;
+        v12 = v13 * v14;
+        v15 = v16 * v17;
+        v18 = v19 * v20;
+        v21 = v22 * v23;
+        v24 = v25 * v26;
+        v27 = v28 * v29;
+        v30 = v31 * v32;
+        v33 = v34 * v35;
+        v36 = v37 * v38;
+        v39 = v40 * v41;
+        v42 = v43 * v44;
+        v45 = v46 * v47;
+        v48 = v49 * v50;
+        v51 = v52 * v53;
+        v54 = v55 * v56;
+        v57 = v58 * v59;
+        v60 = v61 * v62;
+        v63 = v64 * v65;
+        v66 = v67 * v68;
+        v69 = v70 * v71;
+        v72 = v73 * v74;
+        v75 = v76 * v77;
+        v78 = v79 * v80;
+        v81 = v82 * v83;
+        v84 = v85 * v86;
+        v87 = v88 * v89;
+        v90 = v91 * v92;
+        v93 = v94 * v95;
+        v96 = v97 * v98;
+        v99 = v100 * v101;
+        v102 = v103 * v104;
+        v105 = v106 * v107;
+        v108 = v109 * v110;
+        v111 = v112 * v113;
+        v114 = v115 * v116;
+        v117 = v118 * v119;
+        v120 = v121 * v122;
+        v123 = v124 * v125;
+        v126 = v127 * v128;
+        v129 = v130 * v131;
+        v132 = v133 * v134;
+        v135 = v136 * v137;
+        v138 = v139 * v140;
+        v141 = v142 * v143;
+        v144 = v145 * v146;
+        v147 = v148 * v149;
+        v150 = v151 * v152;
+        v153 = v154 * v155;
+        v156 = v157 * v158;
+        v159 = v160 * v161;
+        v162 = v163 * v164;
+        v165 = v166 * v167;
+        v168 = v169 * v170;
+        v171 = v172 * v173;
+        v174 = v175 * v176;
+        v177 = v178 * v179;
+        v180 = v181 * v182;
+        v183 = v184 * v185;
+        v186 = v187 * v188;
+        v189 = v190 * v191;
+        v192 = v193 * v194;
+        v195 = v196 * v197;
+        v198 = v199 * v200;
+        v201 = v202 * v203;
+        v204 = v205 * v206;
+        v207 = v208 * v209;
+        v210 = v211 * v212;
+        v213 = v214 * v215;
+        v216 = v217 * v218;
+        v219 = v220 * v221;
+        v222 = v223 * v224;
+        v225 = v226 * v227;
+        v228 = v229 * v230;
+        v231 = v232 * v233;
+        v234 = v235 * v236;
+        v237 = v238 * v239;
+        v240 = v241 * v242;
+        v243 = v244 * v245;
+        v246 = v247 * v248;
+        v249 = v250 * v251;
+        v252 = v253 * v254;
+        v255 = v256 * v257;
+        v258 = v259 * v260;
+        v261 = v262 * v263;
+        v264 = v265 * v266;
+        v267 = v268 * v269;
+        v270 = v271 * v272;
+        v273 = v274 * v275;
+        v276 = v277 * v278;
+        v279 = v280 * v281;
+        v282 = v283 * v284;
+        v285 = v286 * v287;
+        v288 = v289 * v290;
+        v291 = v292 * v293;
+        v294 = v295 * v296;
+        v297 = v298 * v299;
+        v300 = v301 * v302;
+        v303 = v304 * v305;
+        v306 = v307 * v308;
+        v309 = v310 * v311;
+        v312 = v313 * v314;
+        v315 = v316 * v317;
+        v318 = v319 * v320;
+        v321 = v322 * v323;
+        v324 = v325 * v326;
+        v327 = v328 * v329;
+        v330 = v331 * v332;
+        v333 = v334 * v335;
+        v336 = v337 * v338;
+        v339 = v340 * v341;
+        v342 = v343 * v344;
+        v345 = v346 * v347;
+        v348 = v349 * v350;
+        v351 = v352 * v353;
+        v354 = v355 * v356;
+        v357 = v358 * v359;
+        v360 = v361 * v362;
+        v363 = v364 * v365;
+        v366 = v367 * v368;
+        v369 = v370 * v371;
+        v372 = v373 * v374;
+        v375 = v376 * v377;
+        v378 = v379 * v380;
+        v381 = v382 * v383;
+        v384 = v385 * v386;
+        v387 = v388 * v389;
+        v390 = v391 * v392;
+        v393 = v394 * v395;
+        v396 = v397 * v398;
+        v399 = v400 * v401;
+        v402 = v403 * v404;
+        v405 = v406 * v407;
+        v408 = v409 * v410;
+        v411 = v412 * v413;
+        v414 = v415 * v416;
+        v417 = v418 * v419;
+        v420 = v421 * v422;
+        v423 = v424 * v425;
+        v426 = v427 * v428;
+        v429 = v430 * v431;
+        v432 = v433 * v434;
+        v435 = v436 * v437;
+        v438 = v439 * v440;
+        v441 = v442 * v443;
+        v444 = v445 * v446;
+        v447 = v448 * v449;
+        v450 = v451 * v452;
+        v453 = v454 * v455;
+        v456 = v457 * v458;
+        v459 = v460 * v461;
+        v462 = v463 * v464;
+        v465 = v466 * v467;
+        v468 = v469 * v470;
+        v471 = v472 * v473;
+        v474 = v475 * v476;
+        v477 = v478 * v479;
+        v480 = v481 * v482;
+        v483 = v484 * v485;
+        v486 = v487 * v488;
+        v489 = v490 * v491;
+        v492 = v493 * v494;
+        v495 = v496 * v497;
+        v498 = v499 * v500;
+        v501 = v502 * v503;
+        v504 = v505 * v506;
+        v507 = v508 * v509;
+        v510 = v511 * v512;
+        v513 = v514 * v515;
+        v516 = v517 * v518;
+        v519 = v520 * v521;
+        v522 = v523 * v524;
+        v525 = v526 * v527;
+        v528 = v529 * v530;
+        v531 = v532 * v533;
+        v534 = v535 * v536;
+        v537 = v538 * v539;
+        v540 = v541 * v542;
+        v543 = v544 * v545;
+        v546 = v547 * v548;
+        v549 = v550 * v551;
+        v552 = v553 * v554;
+        v555 = v556 * v557;
+        v558 = v559 * v560;
+        v561 = v562 * v563;
+        v564 = v565 * v566;
+        v567 = v568 * v569;
+        v570 = v571 * v572;
+        v573 = v574 * v575;
+        v576 = v577 * v578;
+        v579 = v580 * v581;
+        v582 = v583 * v584;
+        v585 = v586 * v587;
+        v588 = v589 * v590;
+        v591 = v592 * v593;
+        v594 = v595 * v596;
+        v597 = v598 * v599;
+        v600 = v601 * v602;
+        v603 = v604 * v605;
+        v606 = v607 * v608;
+        v609 = v610 * v611;
+        v612 = v613 * v614;
+        v615 = v616 * v617;
+        v618 = v619 * v620;
+        v621 = v622 * v623;
+        v624 = v625 * v626;
+        v627 = v628 * v629;
+        v630 = v631 * v632;
+        v633 = v634 * v635;
+        v636 = v637 * v638;
+        v639 = v640 * v641;
+        v642 = v643 * v644;
+        v645 = v646 * v647;
+        v648 = v649 * v650;
+        v651 = v652 * v653;
+        v654 = v655 * v656;
+        v657 = v658 * v659;
+        v660 = v661 * v662;
+        v663 = v664 * v665;
+        v666 = v667 * v668;
+        v669 = v670 * v671;
+        v672 = v673 * v674;
+        v675 = v676 * v677;
+        v678 = v679 * v680;
+        v681 = v682 * v683;
+        v684 = v685 * v686;
+        v687 = v688 * v689;
+        v690 = v691 * v692;
+        v693 = v694 * v695;
+        v696 = v697 * v698;
+        v699 = v700 * v701;
+        v702 = v703 * v704;
+        v705 = v706 * v707;
+        v708 = v709 * v710;
+        v711 = v712 * v713;
+        v714 = v715 * v716;
+        v717 = v718 * v719;
+        v720 = v721 * v722;
+        v723 = v724 * v725;
+        v726 = v727 * v728;
+        v729 = v730 * v731;
+        v732 = v733 * v734;
+        v735 = v736 * v737;
+        v738 = v739 * v740;
+        v741 = v742 * v743;
+        v744 = v745 * v746;
+        v747 = v748 * v749;
+        v750 = v751 * v752;
+        v753 = v754 * v755;
+        v756 = v757 * v758;
+        v759 = v760 * v761;
+        v762 = v763 * v764;
+        v765 = v766 * v767;
+        v768 = v769 * v770;
+        v771 = v772 * v773;
+        v774 = v775 * v776;
+        v777 = v778 * v779;
+        v780 = v781 * v782;
+        v783 = v784 * v785;
+        v786 = v787 * v788;
+        v789 = v790 * v791;
+        v792 = v793 * v794;
+        v795 = v796 * v797;
+        v798 = v799 * v800;
+        v801 = v802 * v803;
+        v804 = v805 * v806;
+        v807 = v808 * v809;
+        v810 = v811 * v812;
+        v813 = v814 * v815;
+        v816 = v817 * v818;
+        v819 = v820 * v821;
+        v822 = v823 * v824;
+        v825 = v826 * v827;
+        v828 = v829 * v830;
+        v831 = v832 * v833;
+        v834 = v835 * v836;
+        v837 = v838 * v839;
+        v840 = v841 * v842;
+        v843 = v844 * v845;
+        v846 = v847 * v848;
+        v849 = v850 * v851;
+        v852 = v853 * v854;
+        v855 = v856 * v857;
+        v858 = v859 * v860;
+        v861 = v862 * v863;
+        v864 = v865 * v866;
+        v867 = v868 * v869;
+        v870 = v871 * v872;
+        v873 = v874 * v875;
+        v876 = v877 * v878;
+        v879 = v880 * v881;
+        v882 = v883 * v884;
+        v885 = v886 * v887;
+        v888 = v889 * v890;
+        v891 = v892 * v893;
+        v894 = v895 * v896;
+        v897 = v898 * v899;
+        n = n - v0;
+    }
+    return v0 + v897;
+}